@@ -0,0 +1,93 @@
+addi $s0, $zero, 10
+addi $a0, $zero, 64
+addi $v0, $zero, 9
+syscall
+add $s1, $v0, $zero
+addi $t0, $zero, 0
+addi $t1, $zero, 0
+loop:
+addu $t0, $t0, $t1
+sll $t2, $t1, 2
+addu $t3, $s1, $t2
+sw $t0, 0($t3)
+addi $t1, $t1, 1
+slt $t5, $t1, $s0
+bne $t5, $zero, loop
+add $a0, $t0, $zero
+jal print
+lw $t4, 16($s1)
+sh $t4, 40($s1)
+lhu $a0, 40($s1)
+jal print
+sb $t0, 44($s1)
+lbu $a0, 44($s1)
+jal print
+lui $t6, 4660
+ori $t6, $t6, 22136
+multu $t6, $s0
+mfhi $a0
+jal print
+mflo $a0
+jal print
+addi $t7, $zero, -100
+mult $t7, $s0
+mfhi $a0
+jal print
+divu $t6, $s0
+mflo $a0
+jal print
+div $t7, $s0
+mflo $a0
+jal print
+mfhi $a0
+jal print
+nor $t8, $t7, $zero
+srl $a0, $t8, 1
+jal print
+sltiu $a0, $t7, 5
+jal print
+slti $a0, $t7, 5
+jal print
+sltu $a0, $s0, $t7
+jal print
+andi $a0, $t6, 255
+jal print
+and $a0, $t6, $t7
+jal print
+or $a0, $t0, $s0
+jal print
+mul $a0, $t7, $s0
+jal print
+sub $a0, $s0, $t7
+jal print
+subu $a0, $t7, $s0
+jal print
+addiu $a0, $t7, 7
+jal print
+ll $t9, 0($s1)
+addi $t9, $t9, 5
+sc $t9, 0($s1)
+sync
+add $a0, $t9, $zero
+jal print
+lw $a0, 0($s1)
+jal print
+addi $s2, $zero, 3
+countdown:
+addi $s2, $s2, -1
+bne $s2, $zero, countdown
+beq $s2, $zero, finish
+add $a0, $zero, $zero
+jal print
+finish:
+addi $a0, $zero, 0
+addi $v0, $zero, 17
+syscall
+print:
+addi $v0, $zero, 1
+syscall
+addi $a0, $zero, 10
+addi $v0, $zero, 11
+syscall
+jr $ra
+q
@@ -0,0 +1,28 @@
+addi $t0, $zero, 1000
+increment:
+ll $t1, -16($gp)
+addi $t1, $t1, 1
+sc $t1, -16($gp)
+beq $t1, $zero, increment
+addi $t0, $t0, -1
+bne $t0, $zero, increment
+finish:
+ll $t1, -12($gp)
+addi $t1, $t1, 1
+sc $t1, -12($gp)
+beq $t1, $zero, finish
+bne $a0, $zero, done
+wait:
+lw $t1, -12($gp)
+bne $t1, $a1, wait
+sync
+lw $a0, -16($gp)
+addi $v0, $zero, 1
+syscall
+addi $a0, $zero, 10
+addi $v0, $zero, 11
+syscall
+done:
+addi $v0, $zero, 10
+syscall
+q
@@ -0,0 +1,21 @@
+bne $a0, $zero, reader
+addi $t0, $zero, 42
+sw $t0, -12($gp)
+sync
+addi $t1, $zero, 1
+sw $t1, -16($gp)
+j done
+reader:
+lw $t1, -16($gp)
+beq $t1, $zero, reader
+sync
+lw $a0, -12($gp)
+addi $v0, $zero, 1
+syscall
+addi $a0, $zero, 10
+addi $v0, $zero, 11
+syscall
+done:
+addi $v0, $zero, 10
+syscall
+q
@@ -0,0 +1,29 @@
+bne $a0, $zero, reader
+addi $t0, $zero, 1
+addi $t3, $zero, 20001
+writer:
+sw $t0, -12($gp)
+sync
+sw $t0, -16($gp)
+addi $t0, $t0, 1
+bne $t0, $t3, writer
+j done
+reader:
+addi $t3, $zero, 20000
+poll:
+lw $t1, -16($gp)
+sync
+lw $t2, -12($gp)
+sltu $t4, $t2, $t1
+add $s0, $s0, $t4
+bne $t1, $t3, poll
+add $a0, $s0, $zero
+addi $v0, $zero, 1
+syscall
+addi $a0, $zero, 10
+addi $v0, $zero, 11
+syscall
+done:
+addi $v0, $zero, 10
+syscall
+q
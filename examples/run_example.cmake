@@ -0,0 +1,92 @@
+# Run an example Program and check its Output:
+#   cmake -DCONSOLE=<mips_console> -DPROGRAM=<program.s> -DEXPECTED=<program.expected> [-DOPTIONS="<options>"] [<check>] -P run_example.cmake
+# The Console Output must match the Expected file (with --lockstep, once the "No Divergence" line is removed), or <check> is one of
+#   -DREPLAY_LOG=<log>          the Output recorded into the Log, then the Output replayed from it, must match the Expected file
+#   -DAOT_PROGRAM=<binary>      the Program Output and the Registers of the mips_aot_program build must match the Expected file
+#   -DPROGRAM_OUTPUT=<text>     the Program Output must be the text
+# The Program Output is the text the Syscalls printed after the last Prompt, up to the Instructions listing.
+
+separate_arguments(OPTIONS)
+set(ENV{TERM} dumb)
+
+# Run the Console on the Program with the Options and extra Arguments
+function(run_console outputVariable)
+    execute_process(COMMAND ${CONSOLE} ${OPTIONS} ${ARGN}
+                    INPUT_FILE ${PROGRAM}
+                    OUTPUT_VARIABLE consoleOutput
+                    RESULT_VARIABLE consoleResult)
+
+    if(NOT consoleResult EQUAL 0)
+        message(FATAL_ERROR "${CONSOLE} ${OPTIONS} ${ARGN} < ${PROGRAM} failed (${consoleResult}):\n${consoleOutput}")
+    endif()
+
+    set(${outputVariable} "${consoleOutput}" PARENT_SCOPE)
+endfunction()
+
+# Extract the Program Output from the Console Output
+function(extract_program_output consoleOutput outputVariable)
+    string(FIND "${consoleOutput}" "\nInstructions:" outputEnd)
+    string(SUBSTRING "${consoleOutput}" 0 ${outputEnd} programOutput)
+    string(REGEX REPLACE "^.*0x[0-9A-F]+: " "" programOutput "${programOutput}")
+
+    set(${outputVariable} "${programOutput}" PARENT_SCOPE)
+endfunction()
+
+# Fail unless an Output matches the expected one
+function(check_output description actualOutput expectedOutput)
+    if(NOT actualOutput STREQUAL expectedOutput)
+        message(FATAL_ERROR "${description} does not match ${EXPECTED}:\n${actualOutput}")
+    endif()
+endfunction()
+
+file(READ ${EXPECTED} expectedOutput)
+
+if(DEFINED PROGRAM_OUTPUT)
+    run_console(consoleOutput)
+    extract_program_output("${consoleOutput}" programOutput)
+
+    if(NOT programOutput STREQUAL PROGRAM_OUTPUT)
+        message(FATAL_ERROR "${PROGRAM} printed \"${programOutput}\", expected \"${PROGRAM_OUTPUT}\"")
+    endif()
+elseif(DEFINED REPLAY_LOG)
+    run_console(recordedOutput --record ${REPLAY_LOG})
+    check_output("Recorded Output" "${recordedOutput}" "${expectedOutput}")
+
+    # The replayed Program is read from the Log: the Console prints no Prompts
+    run_console(replayedOutput --replay ${REPLAY_LOG})
+    string(REGEX REPLACE "^Type the Instructions[^\n]*\n\n(0x[0-9A-F]+: )*" "" expectedOutput "${expectedOutput}")
+    check_output("Replayed Output" "${replayedOutput}" "${expectedOutput}")
+elseif(DEFINED AOT_PROGRAM)
+    execute_process(COMMAND ${AOT_PROGRAM} --registers
+                    OUTPUT_VARIABLE aotOutput
+                    RESULT_VARIABLE aotResult)
+
+    if(NOT aotResult EQUAL 0)
+        message(FATAL_ERROR "${AOT_PROGRAM} --registers failed (${aotResult}):\n${aotOutput}")
+    endif()
+
+    # The native Program prints the Program Output, then the Registers in the format of the Console
+    string(FIND "${aotOutput}" "$zero" registersStart)
+    string(SUBSTRING "${aotOutput}" 0 ${registersStart} aotProgramOutput)
+    string(REGEX MATCHALL "\n\\$[^\n]*" aotRegisters "\n${aotOutput}")
+
+    extract_program_output("${expectedOutput}" programOutput)
+    string(REGEX MATCHALL "\n\\$[^\n]*" registers "${expectedOutput}")
+
+    string(STRIP "${aotProgramOutput}" aotProgramOutput)
+    string(STRIP "${programOutput}" programOutput)
+    check_output("Program Output of ${AOT_PROGRAM}" "${aotProgramOutput}" "${programOutput}")
+    check_output("Registers of ${AOT_PROGRAM}" "${aotRegisters}" "${registers}")
+else()
+    run_console(consoleOutput)
+
+    if(OPTIONS MATCHES "--lockstep")
+        if(NOT consoleOutput MATCHES "No Divergence in [0-9]+ Steps\n")
+            message(FATAL_ERROR "The Engines diverged:\n${consoleOutput}")
+        endif()
+
+        string(REGEX REPLACE "No Divergence in [0-9]+ Steps\n" "" consoleOutput "${consoleOutput}")
+    endif()
+
+    check_output("Output" "${consoleOutput}" "${expectedOutput}")
+endif()
@@ -0,0 +1,78 @@
+#ifndef AOT_TRANSLATOR_H_INCLUDED
+#define AOT_TRANSLATOR_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+class AotContext;
+class PerfMap;
+
+/**
+ * Dispatcher of a translated Program - runs the Block starting at an Address and returns the Address the Execution continues at
+ */
+typedef uint32_t (*AotDispatcher)(AotContext&, uint32_t);
+
+/**
+ * Generated Block of a translated Program - the host function and the Guest Address of its first Instruction
+ */
+struct AotBlock {
+    uint32_t guestAddress;                  ///< Guest Address of the first Instruction of the Block
+    uint32_t (*hostCode)(AotContext&);      ///< Function generated for the Block
+};
+
+/**
+ * Run-time State of a Program translated ahead of time - the generated Blocks work on the native Registers,
+ * the Guest Memory, the Syscalls and the Instructions without a Block are left to the Execution Scope
+ */
+class AotContext {
+    public:
+        AotContext(ExecutionScope* executionScope);
+
+        uint64_t run(AotDispatcher dispatcher);
+
+        uint32_t loadWord(uint32_t address);
+        bool storeWord(uint32_t address, uint32_t wordValue);
+        uint32_t loadLinked(uint32_t address);
+        uint32_t storeConditional(uint32_t address, uint32_t wordValue);
+        void syscall(uint32_t address);
+        uint32_t halt(enum HaltReason haltReason, uint32_t address);
+        uint32_t interpret(uint32_t address);
+
+        void publishBlocks(PerfMap& perfMap, const std::vector<AotBlock>& blocks, const void* blocksEnd);
+
+        uint32_t registers[32];             ///< General-purpose Registers
+        uint32_t HI = 0;                    ///< High Word of the Multiply / Divide Unit
+        uint32_t LO = 0;                    ///< Low Word of the Multiply / Divide Unit
+        uint64_t instructionCount = 0;      ///< Instructions executed
+
+    private:
+        void loadRegisters();
+        void storeRegisters();
+        bool isHalted();
+
+        ExecutionScope* executionScope;
+        uint32_t textStart;
+        uint32_t textEnd;
+        bool isTextModified = false;        //Set by a Store to the Text Segment: the generated Blocks are stale, the Execution Scope runs the rest of the Program
+};
+
+/**
+ * Ahead-of-time Translator - emits a C++ Translation Unit with one function per Basic Block of the Program and a switch-based Dispatcher,
+ * to be built against the emulator Library
+ */
+class AotTranslator {
+    public:
+        AotTranslator(ExecutionScope* executionScope, const std::vector<std::string>& programLines);
+
+        void emit(std::ostream& output) const;
+
+    private:
+        void emitBlock(const BasicBlock& basicBlock, std::ostream& output) const;
+        bool emitInstruction(uint32_t insValue, uint32_t insAddress, uint32_t remainingCount, std::ostream& output) const;
+
+        ExecutionScope* executionScope;
+        std::vector<std::string> programLines;
+        ControlFlowGraph controlFlowGraph;
+};
+
+#endif // AOT_TRANSLATOR_H_INCLUDED
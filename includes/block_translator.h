@@ -0,0 +1,80 @@
+#ifndef BLOCK_TRANSLATOR_H_INCLUDED
+#define BLOCK_TRANSLATOR_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+class ControlFlowGraph;
+
+/**
+ * Operation of a Translated Block - one per Guest Instruction
+ */
+struct TranslatedOperation {
+    enum TranslatedOpcode translatedOpcode;
+    uint32_t (*operation)(uint32_t, uint32_t);  ///< Operation of the Register and Immediate Opcodes
+    bool (*condition)(uint32_t, uint32_t);      ///< Condition of the Branches
+    uint8_t dest, left, right;                  ///< Slots of the block-local Register File
+    uint32_t immediate;                         ///< Extended Immediate / Shift amount / Constant / Branch or Jump target
+    uint32_t valueMask;                         ///< Bits of the Word kept by a Load / written by a Store
+    uint32_t address;                           ///< Address of the Guest Instruction
+    uint32_t dirtyMask;                         ///< Slots written by the previous Operations (written back on a side exit before this Operation)
+};
+
+/**
+ * Run of straight-line Instructions of a Basic Block translated once - the Guest Registers it uses live in a block-local Register File,
+ * the live-in ones are loaded at the entry and the written ones are stored back at the exit only
+ */
+struct TranslatedBlock {
+    uint32_t startAddress;                  ///< Address of the first Instruction
+    uint32_t endAddress;                    ///< Address following the last Instruction
+    uint8_t slotRegisters[32];              ///< Guest Register held by each Slot
+    uint32_t slotCount;
+    uint32_t liveInMask;                    ///< Slots read before being written (loaded at the entry)
+    uint32_t dirtyMask;                     ///< Slots written by the Block (stored back at the exit)
+    uint8_t stackSlot, globalSlot;          ///< Slots of $sp and $gp (read by the Loads to check the allocated Memory)
+    bool endsBlock;                         ///< True if the last Operation is a Branch or a Jump
+    std::vector<TranslatedOperation> translatedOperations;
+};
+
+/**
+ * Translates the Basic Blocks of the Text Segment once at load time and runs the Translations -
+ * a Block is translated up to its first Instruction that must run in the Execution Scope (jal, jr, mult / div, mfhi / mflo, syscall, break),
+ * the Translation restarts after it
+ */
+class BlockTranslator {
+    public:
+        void analyze(const ControlFlowGraph& controlFlowGraph, uint32_t textStart);
+        void invalidate(uint32_t address);
+        void clear();
+
+        const TranslatedBlock* find(uint32_t address) const;
+        uint64_t execute(ExecutionScope* executionScope, const TranslatedBlock& translatedBlock) const;
+
+        size_t getBlockCount() const;
+        uint64_t getInstructionCount() const;
+
+    private:
+        bool translateInstruction(uint32_t insValue, uint32_t insAddress, TranslatedBlock& translatedBlock, uint32_t& writtenMask) const;
+
+        uint32_t textStart = 0;
+        std::vector<TranslatedBlock> translatedBlocks;
+        std::vector<int32_t> blockIndexes;                  //One Entry per Word of the Text Segment: Translation starting there (-1 = none)
+};
+
+/**
+ * Find the Translation starting at an Address
+ *
+ * @param address Address of the first Instruction
+ * @return Translated Block, nullptr if no Translation starts at the Address
+ */
+inline const TranslatedBlock* BlockTranslator::find(uint32_t address) const {
+    uint32_t wordIndex = (address - this->textStart) >> 2;
+
+    if(wordIndex >= this->blockIndexes.size() || this->blockIndexes[wordIndex] < 0) {
+        return nullptr;
+    }
+
+    return &this->translatedBlocks[this->blockIndexes[wordIndex]];
+}
+
+#endif // BLOCK_TRANSLATOR_H_INCLUDED
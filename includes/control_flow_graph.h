@@ -0,0 +1,60 @@
+#ifndef CONTROL_FLOW_GRAPH_H_INCLUDED
+#define CONTROL_FLOW_GRAPH_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/**
+ * Basic Block of the Control-Flow Graph - straight-line Instructions from a Leader to a control transfer (or to the next Leader)
+ */
+struct BasicBlock {
+    uint32_t startAddress;      ///< Address of the Leader
+    uint32_t endAddress;        ///< Address following the last Instruction of the Block
+    enum BlockExit blockExit;   ///< How the Execution leaves the Block
+    uint32_t firstEdge;         ///< Index of the first outgoing Edge
+    uint32_t edgeCount;         ///< Number of outgoing Edges
+};
+
+/**
+ * Edge of the Control-Flow Graph
+ */
+struct ControlFlowEdge {
+    uint32_t sourceAddress;     ///< Leader of the Block the Edge leaves
+    uint32_t targetAddress;     ///< Leader of the Block the Edge enters
+    enum EdgeType edgeType;
+};
+
+/**
+ * Static Control-Flow Graph of the Text Segment, built once from the loaded Instructions
+ * (Branch and Jump targets are the Addresses the Execution really continues at, as computed by the Instruction Handlers)
+ */
+class ControlFlowGraph {
+    public:
+        ControlFlowGraph(ExecutionScope* executionScope);
+
+        const std::vector<BasicBlock>& getBlocks() const;
+        const std::vector<ControlFlowEdge>& getEdges() const;
+        const std::vector<uint32_t>& getCallTargets() const;
+        const std::vector<uint32_t>& getIndirectSites() const;
+
+        const BasicBlock* findBlock(uint32_t address) const;
+        uint32_t getWord(uint32_t address) const;
+        std::string getBlockName(const BasicBlock& basicBlock) const;
+
+        void printDot(std::ostream& output) const;
+
+    private:
+        void build();
+
+        ExecutionScope* executionScope;
+        std::vector<uint32_t> textWords;                //Words of the Text Segment (read once, without triggering the Watchpoints)
+        uint32_t textStart;
+
+        std::vector<BasicBlock> basicBlocks;            //Sorted by Address
+        std::vector<ControlFlowEdge> edges;             //Grouped by source Block
+        std::vector<uint32_t> callTargets;              //Addresses called by a jal, sorted
+        std::vector<uint32_t> indirectSites;            //Addresses of the jr Instructions (including the Returns), sorted
+};
+
+#endif // CONTROL_FLOW_GRAPH_H_INCLUDED
@@ -0,0 +1,51 @@
+#ifndef DIFFERENTIAL_EXECUTION_H_INCLUDED
+#define DIFFERENTIAL_EXECUTION_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/**
+ * First disagreement between the two Engines of a Differential Execution
+ */
+struct Divergence {
+    enum DivergenceType divergenceType;     ///< Part of the State that differs (NO_DIVERGENCE if the Engines agree)
+    uint64_t stepIndex;                     ///< Index of the Step after which the Engines disagree
+    uint32_t stepPC;                        ///< Program Counter at the start of the Step (both Engines agreed on it)
+    uint64_t stepLength;                    ///< Number of Instructions executed by the Reference Engine during the Step
+    uint32_t location;                      ///< Register Number (32 = HI, 33 = LO) or Guest Address of the Word that differs
+    uint32_t referenceValue;                ///< Value seen by the Reference Engine (PC, Register, Word or Halt Reason)
+    uint32_t candidateValue;                ///< Value seen by the Candidate Engine
+};
+
+class DifferentialExecution {
+    public:
+        DifferentialExecution(ExecutionScope* referenceScope, ExecutionScope* candidateScope, enum StepGranularity stepGranularity);
+        DifferentialExecution(const DifferentialExecution&) = delete;
+        ~DifferentialExecution();
+
+        bool run(uint64_t maxSteps);
+        const Divergence& getDivergence() const;
+        uint64_t getStepCount() const;
+        void printDivergence(std::ostream& output) const;
+
+    private:
+        static const uint32_t stateRegisters = 34;     //General Purpose Registers, HI and LO
+
+        bool compareRegisters();
+        bool compareMemory();
+        void readRegisters(ExecutionScope* executionScope, uint32_t* registerValues);
+
+        ExecutionScope* referenceScope;
+        ExecutionScope* candidateScope;
+        enum StepGranularity stepGranularity;
+
+        uint64_t stepCount = 0;
+        Divergence divergence;
+
+        std::vector<uint32_t> dirtyPages;              //Pages written by either Engine during the last Step
+        std::vector<uint8_t> referencePage;
+        std::vector<uint8_t> candidatePage;
+};
+
+#endif // DIFFERENTIAL_EXECUTION_H_INCLUDED
@@ -0,0 +1,27 @@
+#ifndef DISASSEMBLER_H_INCLUDED
+#define DISASSEMBLER_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/**
+ * Maximum length of a disassembled Instruction (longer Label names are truncated)
+ */
+static const size_t maxDisassemblyLength = 128;
+
+class Disassembler {
+    public:
+        Disassembler(ExecutionScope* executionScope);
+
+        size_t disassemble(uint32_t insValue, uint32_t insAddress, char* buffer, size_t bufferSize) const;
+        void disassemble(uint32_t beginAddress, uint32_t endAddress, std::ostream& output) const;
+
+        const char* findLabel(uint32_t address) const;
+
+    private:
+        ExecutionScope* executionScope;
+        const SymbolTable& symbolTable;
+};
+
+#endif // DISASSEMBLER_H_INCLUDED
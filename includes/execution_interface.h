@@ -6,12 +6,44 @@
 class ExecutionInterface {
     public:
         ExecutionInterface();
+        ExecutionInterface(enum MemoryBackend memoryBackend);
         void executeInterface();
+        void setInstructionBudget(uint64_t maxInstructions);
+        void setLockstep(enum StepGranularity stepGranularity, enum LockstepEngine lockstepEngine);
+        void setReplayLog(ReplayLog* replayLog);
+        void setPrintStatistics(bool printStatistics);
+        void setProfile(const std::string& profilePath, uint32_t sampleInterval);
+        void setGraphOutput(const std::string& graphPath);
+        void setFusion(bool fusionEnabled);
+        void setTranslation(bool translationEnabled);
+        void setCores(uint32_t coreCount);
+        void setQuantum(uint64_t quantum, uint32_t workerCount);
+        void setGuests(uint32_t guestCount, uint32_t loopCount, uint64_t sliceLength);
 
     private:
         void clearScreen();
+        void executeMachine();
+        void executeLoops();
 
         ExecutionScope* executionScope;
+        enum MemoryBackend memoryBackend;
+        uint64_t instructionBudget = 0;
+        bool lockstepEnabled = false;                   //Runs a second Engine in lockstep
+        enum StepGranularity lockstepGranularity = STEP_INSTRUCTION;
+        enum LockstepEngine lockstepEngine = LOCKSTEP_MEMORY;
+        ReplayLog* replayLog = nullptr;                 //Log the Program and the Inputs are recorded to / replayed from
+        bool printStatistics = false;                   //Prints the Instruction Mix after the Execution State
+        std::string profilePath;                        //File the collapsed Call Stacks are written to ("" = not profiling)
+        uint32_t sampleInterval;                        //Microseconds of CPU time between two Samples
+        std::string graphPath;                          //File the Control-Flow Graph is written to in DOT format ("" = none)
+        bool fusionEnabled = true;                      //Runs the common pairs of Instructions as Fused Operations
+        bool translationEnabled = true;                 //Runs the straight-line Instructions as Translated Blocks
+        uint32_t coreCount = 1;                         //Cores of the Guest Machine (1 = a single Execution Scope)
+        uint64_t quantum = 0;                           //Instructions per Core and round of the deterministic Scheduler (0 = one free-running thread per Core)
+        uint32_t workerCount = 0;                       //Worker threads of the deterministic Scheduler (0 = one per host CPU)
+        uint32_t guestCount = 1;                        //Copies of the Program run by the Event Loops (1 = a single Execution Scope)
+        uint32_t loopCount = 1;                         //Event Loops, each one on its own host thread
+        uint64_t sliceLength;                           //Instructions a Guest runs per turn of its Event Loop
         std::vector<std::string> instructions;
 };
 
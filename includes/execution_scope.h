@@ -3,50 +3,172 @@
 
 #include "instruction.h"
 
+class ExecutionScope;
+class ReplayLog;
+
+/**
+ * Function called when a Breakpoint is hit - returns True to keep running, False to stop the Execution
+ */
+typedef std::function<bool(ExecutionScope*, uint32_t)> BreakpointCallback;
+
+/**
+ * Function called when a Watchpoint is hit - receives the Program Counter, the Address, the old and the new Value, returns True to keep running, False to stop the Execution
+ */
+typedef std::function<bool(ExecutionScope*, uint32_t, uint32_t, uint32_t, uint32_t)> WatchpointCallback;
+
+/**
+ * Function called when the Guest reads a line of Input - fills the line and returns True, or returns False if no Input is available yet (the Execution stops until it is resumed)
+ */
+typedef std::function<bool(ExecutionScope*, std::string&)> InputCallback;
+
+/**
+ * Function called with the Guest Output when it is flushed, in place of the Console
+ */
+typedef std::function<void(ExecutionScope*, const char*, size_t)> OutputCallback;
+
 class ExecutionScope {
     public:
-        ExecutionScope(std::vector<std::string> instructions);
+        ExecutionScope(const std::vector<std::string>& instructions);
+        ExecutionScope(const std::vector<std::string>& instructions, enum MemoryBackend memoryBackend);
 
         void executeScope();
+        void run();
+        uint64_t step(uint64_t count);
+        uint64_t stepBlock();
+        void runUntil(uint32_t address);
+        void runUntil(const std::string& label);
+        void executeSyscall();
+        void flushOutput();
+        void halt(enum HaltReason haltReason);
+
+        bool addBreakpoint(uint32_t address);
+        bool addBreakpoint(const std::string& label);
+        bool removeBreakpoint(uint32_t address);
+        bool removeBreakpoint(const std::string& label);
+        void setBreakpointCallback(BreakpointCallback breakpointCallback);
+        void addWatchpoint(uint32_t address, uint32_t size, int watchType);
+        bool removeWatchpoint(uint32_t address, uint32_t size, int watchType);
+        void setWatchpointCallback(WatchpointCallback watchpointCallback);
+        void setInputCallback(InputCallback inputCallback);
+        void setOutputCallback(OutputCallback outputCallback);
+        void setReplayLog(ReplayLog* replayLog);
+        void setProfiler(GuestProfiler* profiler);
+        void setFusion(bool fusionEnabled);
+        void setTranslation(bool translationEnabled);
 
         void printInstructions(enum InputType inputType);
         void printRegisters();
         void printMemory();
+        void printStatistics();
 
-        void loadValue(std::string binaryValue);
+        void loadValue(const std::string& binaryValue);
         void loadValue(const int decimalValue);
-        void loadArray(std::vector<std::string> arrayValue);
-        void loadArray(std::vector<int> arrayValue);
-
-        void setByteValue(std::string byteAddress, std::string byteValue);
-        void setByteValue(std::string byteAddress, std::string byteOffset, std::string byteValue);
-        void setWordValue(std::string wordAddress, std::string wordValue);
-        void setWordValue(std::string wordAddress, std::string byteOffset, std::string wordValue);
-        void setRegisterValue(std::string regPosition, std::string value);
-        void setLabelAddress(std::string label, std::string insAddress);
-        void setPC(std::string newPC);
-        void setPC(std::string addressingValue, enum AddressingType addressingType);
-
-        std::string getByteValue(std::string byteAddress);
-        std::string getByteValue(std::string byteAddress, std::string byteOffset);
-        std::string getWordValue(std::string wordAddress);
-        std::string getWordValue(std::string wordAddress, std::string byteOffset);
-        std::string getRegisterValue(std::string regPosition);
-        std::string getLabelAddress(std::string label);
-        std::string getLabelName(std::string address);
+        void loadArray(const std::vector<std::string>& arrayValue);
+        void loadArray(const std::vector<int>& arrayValue);
+        void loadArray(const uint32_t* arrayValue, size_t arraySize);
+        void loadBytes(const uint8_t* byteValues, size_t byteCount);
+        void fill(uint32_t wordValue, size_t wordCount);
+
+        std::string loadLinked(const std::string& wordAddress, const std::string& byteOffset);
+        bool storeConditional(const std::string& wordAddress, const std::string& byteOffset, const std::string& wordValue);
+        void shareMemory(ExecutionScope* sourceScope);
+
+        void setByteValue(const std::string& byteAddress, const std::string& byteValue);
+        void setByteValue(const std::string& byteAddress, const std::string& byteOffset, const std::string& byteValue);
+        void setWordValue(const std::string& wordAddress, const std::string& wordValue);
+        void setWordValue(const std::string& wordAddress, const std::string& byteOffset, const std::string& wordValue);
+        bool checkedWriteWord(uint32_t address, uint32_t wordValue);
+        void setRegisterValue(const std::string& regPosition, const std::string& value);
+        void setRegisterWord(uint32_t regIndex, uint32_t value);
+        void setLabelAddress(const std::string& label, const std::string& insAddress);
+        void setInstructionBudget(uint64_t maxInstructions);
+        void setHiLo(uint32_t hiValue, uint32_t loValue);
+        void setPC(const std::string& newPC);
+        void setPC(uint32_t newPC);
+        void setPC(const std::string& addressingValue, enum AddressingType addressingType);
+
+        std::string getByteValue(const std::string& byteAddress);
+        std::string getByteValue(const std::string& byteAddress, const std::string& byteOffset);
+        std::string getWordValue(const std::string& wordAddress);
+        std::string getWordValue(const std::string& wordAddress, const std::string& byteOffset);
+        bool checkedReadWord(uint32_t address, uint32_t stackValue, uint32_t globalValue, uint32_t& wordValue);
+        const std::string& getRegisterValue(const std::string& regPosition);
+        uint32_t getRegisterWord(uint32_t regIndex);
+        std::string getLabelAddress(const std::string& label);
+        std::string getLabelName(const std::string& address);
+        const SymbolTable& getSymbolTable() const;
+        GuestMemory& getMemory();
+        GuestProfiler* getProfiler();
+        InstructionMix getInstructionMix();
         std::string getPC();
+        uint32_t getTextStart();
+        uint32_t getTextEnd();
+        uint32_t getHI();
+        uint32_t getLO();
 
         void incPC();
         bool isFinished();
-        bool isAllocated(std::string address);
+        bool isAllocated(const std::string& address);
+        bool isAllocated(uint32_t address, uint32_t stackValue, uint32_t globalValue);
+        bool isBreakpoint(uint32_t address);
+        enum HaltReason getHaltReason();
+        uint64_t getInstructionCount();
+        int getExitCode();
 
     private:
-        std::string PC;
+        uint64_t runInstructions(uint64_t maxInstructions, bool skipBreakpoint, bool singleBlock = false);
+        uint64_t executeBlock(uint64_t maxLength);
+        bool hitBreakpoint();
+        bool isBreakpointInRange(uint32_t startAddress, uint32_t endAddress);
+        void hitWatchpoint(uint32_t address, uint32_t oldValue, uint32_t newValue);
+        void writeOutput(const char* data, size_t size);
+        bool readInput(std::string& inputValue);
+        void storeWords(const uint32_t* arrayValue, size_t arraySize);
+        void storeBytes(const uint8_t* byteValues, size_t byteCount);
+        void storeFill(uint32_t wordValue, size_t wordCount);
+        void replayLoads();
+        void logHalt();
+
+        uint32_t PC;
+        uint32_t HI = 0;                                        //High Word of the Multiply / Divide Unit (Product / Remainder)
+        uint32_t LO = 0;                                        //Low Word of the Multiply / Divide Unit (Product / Quotient)
+        enum HaltReason haltReason = NOT_HALTED;                //Set when the Execution stops
+        int exitCode = 0;
+
+        bool isReserved = false;                                //Set by ll, cleared by sc (the Reservation of the Core)
+        uint32_t reservationAddress = 0;                        //Address of the Word loaded by the last ll
+        uint32_t reservationValue = 0;                          //Value loaded by the last ll (sc only stores if the Word still holds it)
+
+        uint64_t instructionCount = 0;                          //Instructions executed by the last run
+        uint64_t instructionBudget = 0;                         //Maximum number of Instructions per run (0 = unlimited)
 
-        std::map<std::string, std::string> memoryLocations;     //32-bit String (address)   -> 8-bit  String  (byte)
+        std::vector<uint64_t> breakpointBitmap;                 //One bit per Word of the Text Segment
+        uint32_t breakpointCount = 0;
+        uint32_t watchpointCount = 0;
+        uint32_t untilAddress = 0;                              //Temporary Breakpoint set by runUntil
+        bool untilActive = false;
+        BreakpointCallback breakpointCallback = nullptr;
+        WatchpointCallback watchpointCallback = nullptr;
+        InputCallback inputCallback = nullptr;                  //Source of the Guest Input (nullptr = the Console)
+        OutputCallback outputCallback = nullptr;                //Sink of the Guest Output (nullptr = the Console)
+        ReplayLog* replayLog = nullptr;                         //Log the non-deterministic Inputs are recorded to / replayed from
+        GuestProfiler* profiler = nullptr;                      //Sampling Profiler (nullptr = not profiling)
+        bool fusionEnabled = true;                              //Runs the Fused Operations in place of their pairs of Instructions
+        bool translationEnabled = true;                         //Runs the Translated Blocks in place of their Instructions
+
+        std::string outputBuffer;                               //Guest Output waiting to be flushed
+        uint32_t textStart = 0;                                 //Address of the first loaded Instruction
+        uint32_t textEnd = 0;                                   //Address following the last loaded Instruction
+
+        GuestMemory memory;                                     //Paged Guest Memory behind the Software TLB
         std::map<std::string, std::string> listRegisters;       //5-bit  String (register)  -> 32-bit String (word)
-        std::map<std::string, std::string> listLabels;          //Label  String             -> 32-bit String (word)
-        std::map<std::string, std::string> pointerLabels;       //32-bit String (word)      -> Label  String
+        SymbolTable symbolTable;                                //Label Name <-> Label Address
+        ExecutionStatistics statistics;                         //Execution counts of the Blocks
+        MacroOpFusion macroOpFusion;                            //Fused Operations of the Text Segment, found once at load time
+        BlockTranslator blockTranslator;                        //Translated Blocks of the Text Segment, translated once at load time
 };
 
+/* The templated Instruction Handlers use the Execution Scope: they are defined once the class is complete */
+#include "instruction_handlers.h"
+
 #endif // EXECUTION_SCOPE_H_INCLUDED
@@ -0,0 +1,61 @@
+#ifndef EXECUTION_STATISTICS_H_INCLUDED
+#define EXECUTION_STATISTICS_H_INCLUDED
+
+#include "mips_emulator.h"
+
+/**
+ * Counters of a Block of Instructions, identified by its first Address and its Length
+ */
+struct BlockStatistics {
+    uint64_t executionCount;    ///< Times the Block was executed
+    uint64_t fallthroughCount;  ///< Times the Execution continued at the Word following the Block
+};
+
+/**
+ * Instruction Mix of the Execution
+ */
+struct InstructionMix {
+    uint64_t instructionCount;                      ///< Instructions executed
+    uint64_t blockCount;                            ///< Blocks executed
+    uint64_t purposeCounts[4];                      ///< Instructions executed by InstructionPurpose
+    std::map<std::string, uint64_t> opcodeCounts;   ///< Instructions executed by Mnemonic ("" for invalid Instructions)
+    uint64_t loadBytes;                             ///< Bytes read by the Load Instructions
+    uint64_t storeBytes;                            ///< Bytes written by the Store Instructions
+    uint64_t branchCount;                           ///< Conditional Branches executed
+    uint64_t takenCount;                            ///< Conditional Branches taken
+};
+
+class ExecutionStatistics {
+    public:
+        void countBlock(uint32_t blockStart, uint64_t blockLength, uint32_t nextPC);
+        void reset();
+
+        InstructionMix getInstructionMix(GuestMemory& memory) const;
+        void printInstructionMix(GuestMemory& memory, std::ostream& output) const;
+
+    private:
+        std::unordered_map<uint64_t, BlockStatistics> blockStatistics;     //(first Address << 32 | Length) -> Counters
+        uint64_t lastBlockKey = 0;                                          //Key of the last Block counted (0 = none)
+        BlockStatistics* lastBlock = nullptr;                               //Counters of the last Block counted (loops repeat it)
+};
+
+/**
+ * Count one execution of a Block - a single increment when the Block is the one counted last, otherwise one Hash Map lookup
+ *
+ * @param blockStart Address of the first Instruction of the Block
+ * @param blockLength Number of Instructions executed by the Block
+ * @param nextPC Program Counter after the Block
+ */
+inline void ExecutionStatistics::countBlock(uint32_t blockStart, uint64_t blockLength, uint32_t nextPC) {
+    uint64_t blockKey = (static_cast<uint64_t>(blockStart) << 32) | static_cast<uint32_t>(blockLength);
+
+    if(blockKey != this->lastBlockKey) {
+        this->lastBlock = &this->blockStatistics[blockKey];
+        this->lastBlockKey = blockKey;
+    }
+
+    this->lastBlock->executionCount++;
+    this->lastBlock->fallthroughCount += (nextPC == blockStart + 4 * static_cast<uint32_t>(blockLength));
+}
+
+#endif // EXECUTION_STATISTICS_H_INCLUDED
@@ -0,0 +1,46 @@
+#ifndef GUEST_EVENT_LOOP_H_INCLUDED
+#define GUEST_EVENT_LOOP_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/**
+ * Guest of an Event Loop - its Execution Scope, the lines of Input it has not read yet and the Output it wrote
+ */
+struct LoopGuest {
+    std::unique_ptr<ExecutionScope> executionScope;
+    std::deque<std::string> pendingInput;   ///< Lines of Input provided by the host and not read yet
+    std::string output;                     ///< Output written by the Guest
+    bool isWaiting = false;                 ///< True while the Guest waits for Input (out of the Run Queue)
+};
+
+/**
+ * Event Loop running many Guests cooperatively on one host thread - the Guests take turns from a Run Queue: each one runs a Slice
+ * of Instructions, or up to a read Syscall that finds no Input, and goes back to the end of the Queue.
+ * A Guest waiting for Input leaves the Queue until the host provides it. Guests cost an Execution Scope each (no thread, no Console):
+ * their Input comes from provideInput() and their Output is kept per Guest. Event Loops share nothing, several of them run in parallel on different threads.
+ */
+class GuestEventLoop {
+    public:
+        GuestEventLoop(uint64_t sliceLength);
+
+        uint32_t addGuest(const std::vector<std::string>& instructions, enum MemoryBackend memoryBackend);
+        void provideInput(uint32_t guestIndex, const std::string& inputLine);
+        void run();
+
+        ExecutionScope* getGuest(uint32_t guestIndex);
+        const std::string& getOutput(uint32_t guestIndex);
+        uint32_t getGuestCount() const;
+        bool isWaiting(uint32_t guestIndex);
+
+    private:
+        bool readInput(LoopGuest& loopGuest, std::string& inputValue);
+
+        uint64_t sliceLength;
+        std::vector<std::unique_ptr<LoopGuest>> guests;
+        std::deque<uint32_t> runQueue;                  //Guests ready to run, in turn order
+        std::mutex queueLock;                           //Guards the Run Queue and the pending Input (the host can provide Input from another thread)
+};
+
+#endif // GUEST_EVENT_LOOP_H_INCLUDED
@@ -0,0 +1,54 @@
+#ifndef GUEST_MACHINE_H_INCLUDED
+#define GUEST_MACHINE_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/**
+ * Machine of several Guest Cores sharing one Guest Memory - every Core is an Execution Scope with its own Program Counter,
+ * Registers, Reservation and Translations, and runs the Program on its own host thread.
+ *
+ * Memory model (weakly ordered, like MIPS32) - the only description of the guarantees, the Engines implement it as noted:
+ *  - an aligned Word Load or Store is atomic, a Core never sees a torn Word
+ *    (relaxed host atomics on the shared Pages: GuestMemory::readWord / writeWord, Bytes swapped outside the access)
+ *  - a Core sees its own Loads and Stores in Program order, the other Cores may see them in any order
+ *  - sync is a full barrier: the Loads and Stores before it are visible to every Core before the ones after it
+ *    (a seq_cst host fence: SYNC_function, and the statement the AOT Translator emits; the Block Translator leaves sync to the Execution Scope)
+ *  - sc only stores if the Word still holds the Value loaded by the matching ll, the compare and the store are one atomic step
+ *    (a seq_cst host compare-exchange: GuestMemory::compareExchangeWord)
+ *
+ * runQuanta() is the deterministic alternative to run(): the Cores run a fixed Quantum of Instructions per round on a pool of
+ * worker threads, each one on a private view of the Memory (the Memory at the start of the round plus its own writes).
+ * At the barrier that ends the round the written Bytes are published in Core order (a Byte written by several Cores keeps the
+ * Value of the last Core). A Core that reaches ll, sc, sync or syscall stops there, and after the barrier such Cores run one
+ * Quantum each, one after the other in Core order, on the published Memory. The result then only depends on the Program,
+ * the Inputs and the Quantum, never on the number of worker threads or on how the host schedules them.
+ */
+class GuestMachine {
+    public:
+        GuestMachine(const std::vector<std::string>& instructions, uint32_t coreCount);
+
+        void run();
+        void runQuanta(uint64_t quantum, uint32_t workerCount);
+
+        ExecutionScope* getCore(uint32_t coreIndex);
+        uint32_t getCoreCount() const;
+        void printCores();
+
+    private:
+        void startCores();
+        void isolateCores();
+        void joinCores();
+        void publishWrites(uint32_t firstCore, uint32_t endCore);
+        bool isRunnable(uint32_t coreIndex);
+        bool isSerializing(uint32_t coreIndex);
+
+        std::vector<std::unique_ptr<ExecutionScope>> cores;
+        GuestMemory publishedMemory;                    //Memory shared by the Cores (holds the published writes while the Cores run on private views)
+        std::vector<uint32_t> serializingAddresses;     //Addresses of the Instructions that run in Core order (ll, sc, sync, syscall)
+        std::vector<uint32_t> dirtyPages;
+        bool isSerialPhase = false;                     //Set while the Cores stopped at ll, sc, sync or syscall run one after the other
+};
+
+#endif // GUEST_MACHINE_H_INCLUDED
@@ -0,0 +1,271 @@
+#ifndef GUEST_MEMORY_H_INCLUDED
+#define GUEST_MEMORY_H_INCLUDED
+
+#include "mips_emulator.h"
+
+/**
+ * Entry of the Software TLB - caches the translation of a Guest Page into its Host Pointer
+ */
+struct TLBEntry {
+    uint32_t pageNumber;    ///< Guest Page Number cached by the Entry (invalidTag if the Entry is empty)
+    uint8_t* hostPage;      ///< Host Pointer to the first Byte of the Guest Page
+};
+
+/**
+ * Page of the Guest Memory
+ */
+struct MemoryPage {
+    uint8_t data[pageSize];     ///< Bytes of the Page
+    int permissions;            ///< Access Permissions of the Page (PagePermission flags)
+    int watchFlags;             ///< Accesses watched on the Page (WatchType flags), watched Pages are never cached by the TLB
+};
+
+/**
+ * Page Table of the Guest Memory - shared by the Memories of the Cores of a Guest Machine
+ */
+struct PageTable {
+    std::unordered_map<uint32_t, MemoryPage*> pages;    ///< Guest Page Number -> Host Page
+    std::mutex pageLock;                                ///< Guards the Pages map (the Pages are allocated by any Core)
+
+    ~PageTable();
+};
+
+/**
+ * Range of the Guest Memory watched for reads and / or writes
+ */
+struct Watchpoint {
+    uint32_t address;           ///< Guest Address of the first watched Byte
+    uint32_t size;              ///< Number of watched Bytes
+    int watchType;              ///< Accesses that trigger the Watchpoint (WatchType flags)
+};
+
+/**
+ * Function called on a watched access - receives the Address, the Size of the access, whether it is a write, the old and the new Value
+ */
+typedef std::function<void(uint32_t, uint32_t, bool, uint32_t, uint32_t)> MemoryWatchHandler;
+
+/**
+ * Fault raised by an access to the Fast Memory reservation and not yet reported to the accessor
+ */
+struct MemoryFault {
+    volatile sig_atomic_t pending;  ///< Set by the SIGSEGV handler, cleared once the accessor handled the Fault
+    uint32_t address;               ///< Guest Address that caused the Fault
+    bool isWrite;                   ///< True if the Fault was caused by a write
+    uint32_t savedWord;             ///< Word overwritten by a write to a Page that is not writable
+};
+
+extern thread_local MemoryFault memoryFault;
+
+class GuestMemory {
+    public:
+        GuestMemory();
+        GuestMemory(enum MemoryBackend memoryBackend);
+        GuestMemory(const GuestMemory&) = delete;
+        ~GuestMemory();
+
+        enum MemoryBackend getBackend() const;
+
+        bool readByte(uint32_t address, uint8_t& byteValue);
+        bool readWord(uint32_t address, uint32_t& wordValue);
+        bool writeByte(uint32_t address, uint8_t byteValue);
+        bool writeWord(uint32_t address, uint32_t wordValue);
+        bool writeWords(uint32_t address, const uint32_t* wordValues, size_t wordCount);
+        bool writeBytes(uint32_t address, const uint8_t* byteValues, size_t byteCount);
+        bool fillWords(uint32_t address, uint32_t wordValue, size_t wordCount);
+
+        void allocatePages(uint32_t address, uint32_t size, int permissions);
+        void setPermissions(uint32_t address, uint32_t size, int permissions);
+        int getPermissions(uint32_t address);
+        bool isMapped(uint32_t address);
+
+        void addWatchpoint(uint32_t address, uint32_t size, int watchType);
+        bool removeWatchpoint(uint32_t address, uint32_t size, int watchType);
+        void setWatchHandler(MemoryWatchHandler watchHandler);
+
+        void trackDirtyPages(bool isTracking);
+        void collectDirtyPages(std::vector<uint32_t>& pageNumbers);
+        void copyPage(uint32_t pageNumber, uint8_t* pageData);
+
+        bool compareExchangeWord(uint32_t address, uint32_t expectedValue, uint32_t newValue);
+        void share(GuestMemory& sourceMemory);
+        void unshare();
+        void flushTLB();
+
+    private:
+        MemoryPage* findPage(uint32_t pageNumber);
+        MemoryPage* allocatePage(uint32_t pageNumber, int permissions);
+        uint8_t* findBulkPage(uint32_t pageNumber);
+        void invalidateTLB(uint32_t pageNumber);
+        void markDirty(uint32_t pageNumber);
+
+        bool readSlow(uint32_t address, uint32_t size, uint32_t& value);
+        bool writeSlow(uint32_t address, uint32_t size, uint32_t value);
+
+        int calculateWatchFlags(uint32_t pageNumber);
+        void updateWatchFlags(uint32_t address, uint32_t size);
+        void reportWatch(uint32_t address, uint32_t size, bool isWrite, uint32_t oldValue, uint32_t newValue);
+
+        bool reserveFastMemory();
+        void protectFastPage(uint32_t pageNumber);
+        bool resolveFault(uint32_t address, uint32_t size, uint32_t& value);
+        static void handleFault(int signalNumber, siginfo_t* signalInfo, void* signalContext);
+
+        static const uint32_t invalidTag = 0xFFFFFFFF;
+        static const uint8_t pageCommitted = 0x80;
+        static const uint8_t pageWatchShift = 4;
+        static const uint8_t pageWatchMask = (WATCH_READ | WATCH_WRITE) << pageWatchShift;
+        static const uint8_t pageClean = 0x40;                 //Writable Page kept write-protected until its first write (dirty tracking)
+
+        uint8_t* fastBase = nullptr;                            //Base of the 4 GiB reservation (FAST_MEMORY only)
+        uint8_t* fastPermissions = nullptr;                     //Guest Page Number -> Permissions (FAST_MEMORY only)
+
+        std::shared_ptr<PageTable> pageTable;                   //Guest Page Number -> Host Page (shared with the other Cores of a Guest Machine)
+        TLBEntry readTLB[tlbEntries];                           //Pages that can be read
+        TLBEntry writeTLB[tlbEntries];                          //Pages that can be written
+
+        std::vector<Watchpoint> watchpoints;
+        MemoryWatchHandler watchHandler = nullptr;
+
+        std::unique_ptr<uint64_t[]> dirtyBitmap;               //One bit per Guest Page written since the last collection (nullptr if not tracking)
+        std::unique_ptr<uint32_t[]> dirtyList;                 //Dirty Page Numbers in the order of their first write
+        uint32_t dirtyCount = 0;
+};
+
+/**
+ * Load a Big-Endian Word from a Host Pointer
+ *
+ * @param hostPointer Pointer to the first Byte of the Word
+ * @return Value of the Word
+ */
+inline uint32_t loadBigEndian(const uint8_t* hostPointer) {
+    uint32_t wordValue;
+    std::memcpy(&wordValue, hostPointer, 4);
+
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        wordValue = __builtin_bswap32(wordValue);
+    #endif
+
+    return wordValue;
+}
+
+/**
+ * Store a Word in Big-Endian order at a Host Pointer
+ *
+ * @param hostPointer Pointer to the first Byte of the Word
+ * @param wordValue Value of the Word
+ */
+inline void storeBigEndian(uint8_t* hostPointer, uint32_t wordValue) {
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        wordValue = __builtin_bswap32(wordValue);
+    #endif
+
+    std::memcpy(hostPointer, &wordValue, 4);
+}
+
+/**
+ * Load a Big-Endian Word of a Page that other Cores may write - a relaxed atomic load, swapped after the access
+ * (the ordering guarantees are the ones of the GuestMachine memory model)
+ *
+ * @param hostPointer Pointer to the first Byte of the Word (must be aligned)
+ * @return Value of the Word
+ */
+inline uint32_t loadSharedWord(const uint8_t* hostPointer) {
+    uint32_t wordValue = __atomic_load_n(reinterpret_cast<const uint32_t*>(hostPointer), __ATOMIC_RELAXED);
+
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        wordValue = __builtin_bswap32(wordValue);
+    #endif
+
+    return wordValue;
+}
+
+/**
+ * Store a Word in Big-Endian order into a Page that other Cores may read - swapped before the access, then a relaxed atomic store
+ *
+ * @param hostPointer Pointer to the first Byte of the Word (must be aligned)
+ * @param wordValue Value of the Word
+ */
+inline void storeSharedWord(uint8_t* hostPointer, uint32_t wordValue) {
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        wordValue = __builtin_bswap32(wordValue);
+    #endif
+
+    __atomic_store_n(reinterpret_cast<uint32_t*>(hostPointer), wordValue, __ATOMIC_RELAXED);
+}
+
+/**
+ * Read a Word from the Guest Memory - a TLB hit is a tag compare and a pointer add, Fast Memory is a pointer add
+ *
+ * @param address Guest Address of the Word (must be aligned)
+ * @param wordValue Value of the Word read (0 if the Page is not mapped)
+ * @return True if the Page is mapped and readable, otherwise return False
+ */
+inline bool GuestMemory::readWord(uint32_t address, uint32_t& wordValue) {
+    if(this->fastBase != nullptr) {
+        wordValue = loadBigEndian(this->fastBase + address);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        if(__builtin_expect(memoryFault.pending, 0)) {
+            return this->resolveFault(address, 4, wordValue);
+        }
+
+        return true;
+    }
+
+    const TLBEntry& entry = this->readTLB[(address >> pageBits) & (tlbEntries - 1)];
+
+    if(entry.pageNumber == (address >> pageBits)) {
+        wordValue = loadSharedWord(entry.hostPage + (address & (pageSize - 1)));
+        return true;
+    }
+
+    return this->readSlow(address, 4, wordValue);
+}
+
+/**
+ * Write a Word into the Guest Memory - a TLB hit is a tag compare and a pointer add, Fast Memory is a pointer add
+ *
+ * @param address Guest Address of the Word (must be aligned)
+ * @param wordValue Value of the Word to write
+ * @return True if the Word was written, False if the Page is not writable
+ */
+inline bool GuestMemory::writeWord(uint32_t address, uint32_t wordValue) {
+    if(this->fastBase != nullptr) {
+        storeBigEndian(this->fastBase + address, wordValue);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        if(__builtin_expect(memoryFault.pending, 0)) {
+            return this->resolveFault(address, 4, wordValue);
+        }
+
+        return true;
+    }
+
+    const TLBEntry& entry = this->writeTLB[(address >> pageBits) & (tlbEntries - 1)];
+
+    if(entry.pageNumber == (address >> pageBits)) {
+        storeSharedWord(entry.hostPage + (address & (pageSize - 1)), wordValue);
+        return true;
+    }
+
+    return this->writeSlow(address, 4, wordValue);
+}
+
+/**
+ * Mark a Page as written since the last collection (async-signal-safe, the Fast Memory fault handler calls it)
+ *
+ * @param pageNumber Guest Page Number
+ */
+inline void GuestMemory::markDirty(uint32_t pageNumber) {
+    if(this->dirtyBitmap == nullptr) return;
+
+    uint64_t& dirtyWord = this->dirtyBitmap[pageNumber >> 6];
+    uint64_t dirtyBit = 1ull << (pageNumber & 63);
+
+    if(!(dirtyWord & dirtyBit)) {
+        dirtyWord |= dirtyBit;
+        this->dirtyList[this->dirtyCount++] = pageNumber;
+    }
+}
+
+#endif // GUEST_MEMORY_H_INCLUDED
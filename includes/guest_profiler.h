@@ -0,0 +1,56 @@
+#ifndef GUEST_PROFILER_H_INCLUDED
+#define GUEST_PROFILER_H_INCLUDED
+
+#include "mips_emulator.h"
+
+/**
+ * Call made by a jal Instruction, kept on the Shadow Call Stack until the matching jr $ra
+ */
+struct CallFrame {
+    uint32_t functionAddress;   ///< Address the jal jumped to
+    uint32_t returnAddress;     ///< Address stored in $ra by the jal
+};
+
+class GuestProfiler {
+    public:
+        GuestProfiler(uint32_t entryAddress);
+        GuestProfiler(const GuestProfiler&) = delete;
+        ~GuestProfiler();
+
+        bool start(uint32_t sampleInterval);
+        void stop();
+        void reset(uint32_t entryAddress);
+
+        void enterCall(uint32_t functionAddress, uint32_t returnAddress);
+        void leaveCall(uint32_t returnAddress);
+
+        static bool isSamplePending();
+        void takeSample(uint32_t PC);
+
+        uint64_t getSampleCount() const;
+        void printCollapsedStacks(const SymbolTable& symbolTable, std::ostream& output) const;
+
+    private:
+        static void handleTimer(int signalNumber);
+
+        static std::atomic<bool> samplePending;                 //Set by the Timer, cleared by the next Sample
+        static GuestProfiler* activeProfiler;                   //Profiler that owns the process-wide Timer
+
+        uint32_t entryAddress;                                  //Root of every Call Stack
+        std::vector<CallFrame> callStack;                       //Shadow Call Stack (jal pushes, jr $ra pops)
+        uint64_t droppedCalls = 0;                              //Calls not pushed because the Shadow Call Stack was full
+        std::map<std::vector<uint32_t>, uint64_t> sampleCounts; //(Function Addresses..., PC) -> Samples
+        uint64_t sampleCount = 0;
+        std::vector<uint32_t> sampleKey;                        //Reused to build the Key of a Sample
+};
+
+/**
+ * Check whether the Timer asked for a Sample - a single relaxed load, cheap enough for every Block boundary
+ *
+ * @return True if a Sample must be taken
+ */
+inline bool GuestProfiler::isSamplePending() {
+    return samplePending.load(std::memory_order_relaxed);
+}
+
+#endif // GUEST_PROFILER_H_INCLUDED
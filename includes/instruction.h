@@ -8,38 +8,40 @@ class MemoryStructure;
 
 class Instruction {
     public:
-        Instruction(std::string value, InputType inputType);
-        Instruction(std::string value, InputType inputType, ExecutionScope* executionScope);
+        Instruction(const std::string& value, InputType inputType);
+        Instruction(const std::string& value, InputType inputType, ExecutionScope* executionScope);
+        Instruction(const std::string& value, InputType inputType, ExecutionScope* executionScope, std::pmr::memory_resource* memoryResource);
 
         std::string getName();
-        std::string getField(std::string field);
+        std::string getField(const std::string& field);
         std::string getParameter(const int index);
         enum StatementType getStatementType();
+        enum InstructionPurpose getInstructionPurpose();
         std::string getBinary();
         std::string getInstruction();
 
-        void setAddress(std::string instructionAddress);
-        void setField(std::string fieldName, std::string fieldValue);
-        void setParameter(const int index, std::string parameterValue);
+        void setAddress(const std::string& instructionAddress);
+        void setField(const std::string& fieldName, const std::string& fieldValue);
+        void setParameter(const int index, const std::string& parameterValue);
 
-        void parseInstruction(std::string instruction);
-        void parseBinary(std::string binary);
+        void parseInstruction(const std::string& instruction);
+        void parseBinary(const std::string& binary);
 
         std::string calculateBinary();
         std::string calculateInstruction();
-        std::string calculateField(std::string parameterName, std::string parameterValue);
-        std::string calculateParameter(std::string fieldName, std::string fieldValue);
+        std::string calculateField(const std::string& parameterName, const std::string& parameterValue);
+        std::string calculateParameter(const std::string& fieldName, const std::string& fieldValue);
 
         void executeInstruction();
 
     private:
-        std::string name;
-        std::string instructionAddress = "";
+        std::pmr::string name;
+        std::pmr::string instructionAddress;
 
-        std::vector<std::string> parameters;
+        std::pmr::vector<std::pmr::string> parameters;
 
-        std::map<std::string, std::string> memoryFields;
-        const MemoryStructure* memoryStructure;
+        std::pmr::map<std::pmr::string, std::pmr::string, std::less<>> memoryFields;
+        const MemoryStructure* memoryStructure = nullptr;
         enum StatementType statementType;
 
         ExecutionScope* executionScope = nullptr;
@@ -0,0 +1,141 @@
+#ifndef INSTRUCTION_HANDLERS_H_INCLUDED
+#define INSTRUCTION_HANDLERS_H_INCLUDED
+
+#include "mips_emulator.h"
+
+/**
+ * Extend a 16-bit Immediate Field to a Word
+ *
+ * @param immediate Immediate Field
+ * @return Sign- or Zero-extended Immediate
+ */
+template<enum ImmediateExtension Extension>
+constexpr uint32_t extendImmediate(uint32_t immediate) {
+    return (Extension == SIGN_EXTENSION) ? static_cast<uint32_t>(static_cast<int16_t>(immediate & 0xFFFF)) : (immediate & 0xFFFF);
+}
+
+/**
+ * Bits of the Word kept by a Load / written by a Store of a given width
+ *
+ * @param accessBytes Bytes accessed (1, 2 or 4)
+ * @return Mask of the accessed Bits
+ */
+constexpr uint32_t accessMask(uint32_t accessBytes) {
+    return (accessBytes >= 4) ? 0xFFFFFFFF : (1u << (8 * accessBytes)) - 1;
+}
+
+/**
+ * Register-Register Instruction -> R[rd] = Operation(R[rs], R[rt])
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rd, rs, rt)
+ */
+template<typename Operation>
+void RegisterRegister_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rsValue = executionScope->getRegisterWord(toWord(funcParams[1]));
+    uint32_t rtValue = executionScope->getRegisterWord(toWord(funcParams[2]));
+
+    executionScope->setRegisterWord(toWord(funcParams[0]), Operation::apply(rsValue, rtValue));
+    executionScope->incPC();
+}
+
+/**
+ * Register-Immediate Instruction -> R[rt] = Operation(R[rs], Extension(imm))
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rt, rs, imm)
+ */
+template<typename Operation, enum ImmediateExtension Extension>
+void RegisterImmediate_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rsValue = executionScope->getRegisterWord(toWord(funcParams[1]));
+    uint32_t immValue = extendImmediate<Extension>(toWord(funcParams[2]));
+
+    executionScope->setRegisterWord(toWord(funcParams[0]), Operation::apply(rsValue, immValue));
+    executionScope->incPC();
+}
+
+/**
+ * Shift Instruction -> R[rd] = Operation(R[rt], shamt)
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rd, rt, shamt)
+ */
+template<typename Operation>
+void Shift_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rtValue = executionScope->getRegisterWord(toWord(funcParams[1]));
+    uint32_t shamtValue = toWord(funcParams[2]);
+
+    executionScope->setRegisterWord(toWord(funcParams[0]), Operation::apply(rtValue, shamtValue));
+    executionScope->incPC();
+}
+
+/**
+ * Multiply / Divide Instruction -> {HI, LO} = Operation(R[rs], R[rt])
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rs, rt)
+ */
+template<typename Operation>
+void MultiplyDivide_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rsValue = executionScope->getRegisterWord(toWord(funcParams[0]));
+    uint32_t rtValue = executionScope->getRegisterWord(toWord(funcParams[1]));
+    uint32_t hiValue = executionScope->getHI();
+    uint32_t loValue = executionScope->getLO();
+
+    Operation::apply(rsValue, rtValue, hiValue, loValue);
+
+    executionScope->setHiLo(hiValue, loValue);
+    executionScope->incPC();
+}
+
+/**
+ * Branch Instruction -> if(Condition(R[rs], R[rt])) { PC = PC + 4 + BranchAddr }
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rs, rt, imm)
+ */
+template<typename Condition>
+void Branch_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rsValue = executionScope->getRegisterWord(toWord(funcParams[0]));
+    uint32_t rtValue = executionScope->getRegisterWord(toWord(funcParams[1]));
+
+    if(Condition::apply(rsValue, rtValue)) {
+        executionScope->setPC(funcParams[2], PC_RELATIVE_ADDRESSING);
+    } else {
+        executionScope->incPC();
+    }
+}
+
+/**
+ * Load Instruction -> R[rt] = {0, M[R[rs] + SignExtImm](8 * Bytes - 1:0)}
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rt, imm, rs)
+ */
+template<uint32_t Bytes>
+void Load_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t address = executionScope->getRegisterWord(toWord(funcParams[2])) + extendImmediate<SIGN_EXTENSION>(toWord(funcParams[1]));
+    uint32_t wordValue;
+
+    executionScope->checkedReadWord(address, executionScope->getRegisterWord(29), executionScope->getRegisterWord(28), wordValue);
+
+    executionScope->setRegisterWord(toWord(funcParams[0]), wordValue & accessMask(Bytes));
+    executionScope->incPC();
+}
+
+/**
+ * Store Instruction -> M[R[rs] + SignExtImm](8 * Bytes - 1:0) = R[rt](8 * Bytes - 1:0)
+ *
+ * @param executionScope Execution Scope
+ * @param funcParams Parameters Values (rt, imm, rs)
+ */
+template<uint32_t Bytes>
+void Store_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    uint32_t rtValue = executionScope->getRegisterWord(toWord(funcParams[0]));
+    uint32_t address = executionScope->getRegisterWord(toWord(funcParams[2])) + extendImmediate<SIGN_EXTENSION>(toWord(funcParams[1]));
+
+    executionScope->checkedWriteWord(address, rtValue & accessMask(Bytes));
+    executionScope->incPC();
+}
+
+#endif // INSTRUCTION_HANDLERS_H_INCLUDED
@@ -0,0 +1,278 @@
+#ifndef ISA_TABLE_H_INCLUDED
+#define ISA_TABLE_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+
+/*
+ * Operations of the templated Instruction Handlers - the Operands are native 32-bit Words,
+ * the Strings are only converted when the Registers are read and written
+ */
+
+struct AddOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a + b; }
+};
+
+struct SubOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a - b; }
+};
+
+struct MultiplyOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a * b; }
+};
+
+struct AndOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a & b; }
+};
+
+struct OrOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a | b; }
+};
+
+struct NorOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return ~(a | b); }
+};
+
+struct LessThanOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return static_cast<int32_t>(a) < static_cast<int32_t>(b); }
+};
+
+struct LessThanUnsignedOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t b) { return a < b; }
+};
+
+struct ShiftLeftOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t shamt) { return a << (shamt & 31); }
+};
+
+struct ShiftRightOperation {
+    static constexpr uint32_t apply(uint32_t a, uint32_t shamt) { return a >> (shamt & 31); }
+};
+
+struct SignedMultiplyOperation {
+    static constexpr void apply(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t productValue = static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(a)) * static_cast<int64_t>(static_cast<int32_t>(b)));
+
+        hi = static_cast<uint32_t>(productValue >> 32);
+        lo = static_cast<uint32_t>(productValue);
+    }
+};
+
+struct UnsignedMultiplyOperation {
+    static constexpr void apply(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t productValue = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+
+        hi = static_cast<uint32_t>(productValue >> 32);
+        lo = static_cast<uint32_t>(productValue);
+    }
+};
+
+/* HI and LO are left unchanged when dividing by zero, INT_MIN / -1 wraps around (it overflows on the host) */
+struct SignedDivideOperation {
+    static constexpr void apply(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        if(static_cast<int32_t>(b) == -1) {
+            hi = 0;
+            lo = 0u - a;
+        } else if(b != 0) {
+            hi = static_cast<uint32_t>(static_cast<int32_t>(a) % static_cast<int32_t>(b));
+            lo = static_cast<uint32_t>(static_cast<int32_t>(a) / static_cast<int32_t>(b));
+        }
+    }
+};
+
+struct UnsignedDivideOperation {
+    static constexpr void apply(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        if(b != 0) {
+            hi = a % b;
+            lo = a / b;
+        }
+    }
+};
+
+struct EqualCondition {
+    static constexpr bool apply(uint32_t a, uint32_t b) { return a == b; }
+};
+
+struct NotEqualCondition {
+    static constexpr bool apply(uint32_t a, uint32_t b) { return a != b; }
+};
+
+/*
+ * Fields of an encoded Instruction
+ */
+
+constexpr uint32_t opcodeField(uint32_t insValue) { return insValue >> 26; }
+constexpr uint8_t rsField(uint32_t insValue) { return (insValue >> 21) & 31; }
+constexpr uint8_t rtField(uint32_t insValue) { return (insValue >> 16) & 31; }
+constexpr uint8_t rdField(uint32_t insValue) { return (insValue >> 11) & 31; }
+constexpr uint32_t shamtField(uint32_t insValue) { return (insValue >> 6) & 31; }
+constexpr uint32_t functField(uint32_t insValue) { return insValue & 63; }
+constexpr uint32_t immediateField(uint32_t insValue) { return insValue & 0xFFFF; }
+
+/**
+ * Function executing an Instruction on the Execution Scope
+ */
+typedef void (*InstructionHandler)(ExecutionScope*, const std::vector<std::string>&);
+
+template<typename Operation>
+void RegisterRegister_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<typename Operation, enum ImmediateExtension Extension>
+void RegisterImmediate_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<typename Operation>
+void Shift_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<typename Operation>
+void MultiplyDivide_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<typename Condition>
+void Branch_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<uint32_t Bytes>
+void Load_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+template<uint32_t Bytes>
+void Store_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+/**
+ * Handler of a row of the Instruction Set - the Handler of its Kind, specialized on its Operation and access width
+ *
+ * @return Function executing the Instruction
+ */
+template<enum InstructionKind Kind, typename Operation, uint32_t Bytes>
+constexpr InstructionHandler kindHandler() {
+    if constexpr(Kind == KIND_REGISTER) {
+        return RegisterRegister_function<Operation>;
+    } else if constexpr(Kind == KIND_IMMEDIATE) {
+        return RegisterImmediate_function<Operation, SIGN_EXTENSION>;
+    } else if constexpr(Kind == KIND_IMMEDIATE_UNSIGNED) {
+        return RegisterImmediate_function<Operation, ZERO_EXTENSION>;
+    } else if constexpr(Kind == KIND_SHIFT) {
+        return Shift_function<Operation>;
+    } else if constexpr(Kind == KIND_MULTIPLY_DIVIDE) {
+        return MultiplyDivide_function<Operation>;
+    } else if constexpr(Kind == KIND_BRANCH) {
+        return Branch_function<Operation>;
+    } else if constexpr(Kind == KIND_LOAD) {
+        return Load_function<Bytes>;
+    } else if constexpr(Kind == KIND_STORE) {
+        return Store_function<Bytes>;
+    } else if constexpr(Kind == KIND_LOAD_UPPER) {
+        return LUI_function;
+    } else if constexpr(Kind == KIND_LOAD_LINKED) {
+        return LL_function;
+    } else if constexpr(Kind == KIND_STORE_CONDITIONAL) {
+        return SC_function;
+    } else if constexpr(Kind == KIND_SYNC) {
+        return SYNC_function;
+    } else if constexpr(Kind == KIND_MOVE_FROM_HI) {
+        return MFHI_function;
+    } else if constexpr(Kind == KIND_MOVE_FROM_LO) {
+        return MFLO_function;
+    } else if constexpr(Kind == KIND_JUMP) {
+        return J_function;
+    } else if constexpr(Kind == KIND_CALL) {
+        return JAL_function;
+    } else if constexpr(Kind == KIND_JUMP_REGISTER) {
+        return JR_function;
+    } else if constexpr(Kind == KIND_SYSCALL) {
+        return SYSCALL_function;
+    } else {
+        return BREAK_function;
+    }
+}
+
+/**
+ * Pointer to the apply function of an Operation, if it has the requested signature
+ *
+ * @return &Operation::apply, nullptr if the row has no such Operation
+ */
+template<typename Operation, typename Function>
+constexpr Function applyPointer() {
+    if constexpr(std::is_void_v<Operation>) {
+        return nullptr;
+    } else if constexpr(std::is_same_v<decltype(&Operation::apply), Function>) {
+        return &Operation::apply;
+    } else {
+        return nullptr;
+    }
+}
+
+/**
+ * Row of the Instruction Set decoded from an encoded Instruction
+ */
+struct InstructionInfo {
+    const char* mnemonic;                           ///< Mnemonic ("" if the Word is not a valid Instruction)
+    enum InstructionPurpose instructionPurpose;     ///< Purpose of the Instruction
+    enum OperandLayout operandLayout;               ///< Operands, in the order they are written in the source text
+    enum InstructionKind instructionKind;           ///< What the Instruction does
+    uint32_t (*operation)(uint32_t, uint32_t);      ///< Operation of the Register, Immediate and Shift Kinds (nullptr otherwise)
+    bool (*condition)(uint32_t, uint32_t);          ///< Condition of the Branches (nullptr otherwise)
+    const char* operationName;                      ///< C++ type of the Operation / Condition ("" if none, used by the AOT Translator)
+    uint32_t accessBytes;                           ///< Bytes read or written by the Memory Instructions (0 otherwise)
+};
+
+extern const InstructionInfo& decodeInstruction(uint32_t insValue);
+
+/**
+ * Description of the supported Instruction Set - the only place where an Instruction is defined
+ *
+ * Every row is expanded by X(mnemonic, format, purpose, opcode, funct, operands, kind, operation, bytes):
+ *  - the Instruction Formats (Encoder) and the Instruction Pointers (Decoder) of the Execution Scope are built from mnemonic, format, purpose, opcode, funct and operands,
+ *    the Handler of the Instruction is the one of its Kind (kindHandler), specialized on operation and bytes (defined in instruction_handlers.h and functions.cpp)
+ *  - decodeInstruction (isa_table.cpp) indexes every column by Opcode / Funct for the consumers of encoded Instructions:
+ *    the Disassembler, the Control-Flow Graph, the Statistics, the Macro-Op Fusion, the Block Translator, the AOT Translator and the Guest Machine
+ *
+ * The Funct is "" for the I-Format and J-Format Instructions, the Operands also give the order of the Fields in the source text.
+ * operation is a type of the Operations and Conditions above (void if the Kind has none), bytes is the width of the Memory access (0 if none).
+ * Adding an Instruction of an existing Kind only needs a new row (and a new Operation when no existing one fits); a new Kind also needs its Handler
+ * and a case in the consumers that know it (the Translators leave the Kinds they do not know to the Execution Scope).
+ * The Execution Scope keeps its String Register File: the Handlers convert the Operands to native Words and back.
+ */
+#define MIPS_INSTRUCTION_SET(X) \
+    /*  Mnemonic    Format      Purpose                 Opcode      Funct       Operands                    Kind                        Operation                   Bytes */ \
+    X(  add,        R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "100000",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              AddOperation,               0   ) \
+    X(  addi,       I_FORMAT,   INSTRUCTION_MATHS,      "001000",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE,             AddOperation,               0   ) \
+    X(  addiu,      I_FORMAT,   INSTRUCTION_MATHS,      "001001",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE,             AddOperation,               0   ) \
+    X(  addu,       R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "100001",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              AddOperation,               0   ) \
+    X(  and,        R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "100100",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              AndOperation,               0   ) \
+    X(  andi,       I_FORMAT,   INSTRUCTION_LOGIC,      "001100",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE_UNSIGNED,    AndOperation,               0   ) \
+    X(  beq,        I_FORMAT,   INSTRUCTION_ADDRESS,    "000100",   "",         OPERANDS_RS_RT_BRANCH,      KIND_BRANCH,                EqualCondition,             0   ) \
+    X(  bne,        I_FORMAT,   INSTRUCTION_ADDRESS,    "000101",   "",         OPERANDS_RS_RT_BRANCH,      KIND_BRANCH,                NotEqualCondition,          0   ) \
+    X(  j,          J_FORMAT,   INSTRUCTION_ADDRESS,    "000010",   "",         OPERANDS_JUMP,              KIND_JUMP,                  void,                       0   ) \
+    X(  jal,        J_FORMAT,   INSTRUCTION_ADDRESS,    "000011",   "",         OPERANDS_JUMP,              KIND_CALL,                  void,                       0   ) \
+    X(  jr,         R_FORMAT,   INSTRUCTION_ADDRESS,    "000000",   "001000",   OPERANDS_RS,                KIND_JUMP_REGISTER,         void,                       0   ) \
+    X(  lbu,        I_FORMAT,   INSTRUCTION_MOVE,       "100100",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_LOAD,                  void,                       1   ) \
+    X(  lhu,        I_FORMAT,   INSTRUCTION_MOVE,       "100101",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_LOAD,                  void,                       2   ) \
+    X(  ll,         I_FORMAT,   INSTRUCTION_MOVE,       "110000",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_LOAD_LINKED,           void,                       4   ) \
+    X(  lui,        I_FORMAT,   INSTRUCTION_MOVE,       "001111",   "",         OPERANDS_RT_IMM,            KIND_LOAD_UPPER,            void,                       0   ) \
+    X(  lw,         I_FORMAT,   INSTRUCTION_MOVE,       "100011",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_LOAD,                  void,                       4   ) \
+    X(  nor,        R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "100111",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              NorOperation,               0   ) \
+    X(  or,         R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "100101",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              OrOperation,                0   ) \
+    X(  ori,        I_FORMAT,   INSTRUCTION_LOGIC,      "001101",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE_UNSIGNED,    OrOperation,                0   ) \
+    X(  slt,        R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "101010",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              LessThanOperation,          0   ) \
+    X(  slti,       I_FORMAT,   INSTRUCTION_LOGIC,      "001010",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE,             LessThanOperation,          0   ) \
+    X(  sltiu,      I_FORMAT,   INSTRUCTION_LOGIC,      "001011",   "",         OPERANDS_RT_RS_IMM,         KIND_IMMEDIATE,             LessThanUnsignedOperation,  0   ) \
+    X(  sltu,       R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "101011",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              LessThanUnsignedOperation,  0   ) \
+    X(  sll,        R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "000000",   OPERANDS_RD_RT_SHAMT,       KIND_SHIFT,                 ShiftLeftOperation,         0   ) \
+    X(  srl,        R_FORMAT,   INSTRUCTION_LOGIC,      "000000",   "000010",   OPERANDS_RD_RT_SHAMT,       KIND_SHIFT,                 ShiftRightOperation,        0   ) \
+    X(  sb,         I_FORMAT,   INSTRUCTION_MOVE,       "101000",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_STORE,                 void,                       1   ) \
+    X(  sc,         I_FORMAT,   INSTRUCTION_MOVE,       "111000",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_STORE_CONDITIONAL,     void,                       4   ) \
+    X(  sh,         I_FORMAT,   INSTRUCTION_MOVE,       "101001",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_STORE,                 void,                       2   ) \
+    X(  sw,         I_FORMAT,   INSTRUCTION_MOVE,       "101011",   "",         OPERANDS_RT_OFFSET_BASE,    KIND_STORE,                 void,                       4   ) \
+    X(  sub,        R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "100010",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              SubOperation,               0   ) \
+    X(  subu,       R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "100011",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              SubOperation,               0   ) \
+    X(  sync,       R_FORMAT,   INSTRUCTION_MOVE,       "000000",   "001111",   OPERANDS_NONE,              KIND_SYNC,                  void,                       0   ) \
+    X(  mul,        R_FORMAT,   INSTRUCTION_MATHS,      "011100",   "000010",   OPERANDS_RD_RS_RT,          KIND_REGISTER,              MultiplyOperation,          0   ) \
+    X(  mult,       R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "011000",   OPERANDS_RS_RT,             KIND_MULTIPLY_DIVIDE,       SignedMultiplyOperation,    0   ) \
+    X(  multu,      R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "011001",   OPERANDS_RS_RT,             KIND_MULTIPLY_DIVIDE,       UnsignedMultiplyOperation,  0   ) \
+    X(  div,        R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "011010",   OPERANDS_RS_RT,             KIND_MULTIPLY_DIVIDE,       SignedDivideOperation,      0   ) \
+    X(  divu,       R_FORMAT,   INSTRUCTION_MATHS,      "000000",   "011011",   OPERANDS_RS_RT,             KIND_MULTIPLY_DIVIDE,       UnsignedDivideOperation,    0   ) \
+    X(  mfhi,       R_FORMAT,   INSTRUCTION_MOVE,       "000000",   "010000",   OPERANDS_RD,                KIND_MOVE_FROM_HI,          void,                       0   ) \
+    X(  mflo,       R_FORMAT,   INSTRUCTION_MOVE,       "000000",   "010010",   OPERANDS_RD,                KIND_MOVE_FROM_LO,          void,                       0   ) \
+    X(  syscall,    R_FORMAT,   INSTRUCTION_ADDRESS,    "000000",   "001100",   OPERANDS_NONE,              KIND_SYSCALL,               void,                       0   ) \
+    X(  break,      R_FORMAT,   INSTRUCTION_ADDRESS,    "000000",   "001101",   OPERANDS_NONE,              KIND_BREAK,                 void,                       0   )
+
+#endif // ISA_TABLE_H_INCLUDED
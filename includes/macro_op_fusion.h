@@ -0,0 +1,69 @@
+#ifndef MACRO_OP_FUSION_H_INCLUDED
+#define MACRO_OP_FUSION_H_INCLUDED
+
+#include "mips_emulator.h"
+
+class ExecutionScope;
+class ControlFlowGraph;
+struct FusedOperation;
+
+/**
+ * Function executing both Instructions of a Fused Operation
+ */
+typedef void (*FusedHandler)(ExecutionScope*, const FusedOperation&);
+
+/**
+ * Pair of adjacent Instructions of a Basic Block executed by a single Handler
+ * (first* are the Fields of the first Instruction, second* those of the second one)
+ */
+struct FusedOperation {
+    enum FusionPattern fusionPattern;   ///< Idiom matched by the pair (FUSION_NONE = no Fused Operation at this Address)
+    FusedHandler fusedHandler;
+    uint32_t firstWord;                 ///< Words the pair was decoded from (the Fused Operation is skipped if the Text was overwritten)
+    uint32_t secondWord;
+    uint8_t firstDest, firstLeft, firstRight;
+    uint8_t secondDest, secondLeft, secondRight;
+    uint32_t firstImmediate;            ///< Constant / Shift amount / Increment of the first Instruction
+    uint32_t secondImmediate;           ///< Constant of the second Instruction
+    uint32_t nextAddress;               ///< Address following the pair
+    uint32_t branchTarget;              ///< Target of the second Instruction when it is a taken Branch
+    bool endsBlock;                     ///< True if the second Instruction is a Branch
+};
+
+/**
+ * Peephole pass over the Basic Blocks of the Control-Flow Graph - finds the pairs of Instructions that can run as one Fused Operation
+ * (both Instructions always belong to the same Basic Block: the second one is never a Leader)
+ */
+class MacroOpFusion {
+    public:
+        void analyze(const ControlFlowGraph& controlFlowGraph, uint32_t textStart);
+        void clear();
+
+        const FusedOperation* find(uint32_t address) const;
+        uint64_t getPatternCount(enum FusionPattern fusionPattern) const;
+
+    private:
+        bool matchPair(uint32_t firstWord, uint32_t secondWord, uint32_t firstAddress, FusedOperation& fusedOperation) const;
+
+        uint32_t textStart = 0;
+        std::vector<FusedOperation> fusedOperations;    //One Entry per Word of the Text Segment (FUSION_NONE if no pair starts there)
+        uint64_t patternCounts[5] = {};                 //Pairs found by FusionPattern
+};
+
+/**
+ * Find the Fused Operation starting at an Address
+ *
+ * @param address Address of the first Instruction
+ * @return Fused Operation, nullptr if no pair starts at the Address
+ */
+inline const FusedOperation* MacroOpFusion::find(uint32_t address) const {
+    uint32_t wordIndex = (address - this->textStart) >> 2;
+
+    if(wordIndex >= this->fusedOperations.size() || this->fusedOperations[wordIndex].fusionPattern == FUSION_NONE) {
+        return nullptr;
+    }
+
+    return &this->fusedOperations[wordIndex];
+}
+
+#endif // MACRO_OP_FUSION_H_INCLUDED
@@ -7,22 +7,22 @@ class ExecutionScope;
 
 class MemoryStructure {
     public:
-        MemoryStructure(Format format, InstructionPurpose instructionPurpose, std::string opcode, std::string funct, std::vector<std::string> fieldsOrder, std::function<void(ExecutionScope*, std::vector<std::string>)> instructionFunction);
+        MemoryStructure(Format format, InstructionPurpose instructionPurpose, const std::string& opcode, const std::string& funct, const std::vector<std::string>& fieldsOrder, std::function<void(ExecutionScope*, const std::vector<std::string>&)> instructionFunction);
 
         enum Format getFormat() const;
         enum InstructionPurpose getInstructionPurpose() const;
-        std::string getOpcode() const;
-        std::string getFunct() const;
-        std::vector<std::string> getParametersOrder() const;
+        const std::string& getOpcode() const;
+        const std::string& getFunct() const;
+        const std::vector<std::string>& getParametersOrder() const;
 
-        void executeFunction(ExecutionScope* executionScope, std::vector<std::string> funcParams) const;
+        void executeFunction(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) const;
 
     private:
         enum Format format;
         enum InstructionPurpose instructionPurpose;
         std::string opcode, funct;
         std::vector<std::string> parametersOrder;
-        std::function<void(ExecutionScope*, std::vector<std::string>)> instructionFunction;
+        std::function<void(ExecutionScope*, const std::vector<std::string>&)> instructionFunction;
 };
 
 #endif // MEMORY_STRUCTURE_H_INCLUDED
@@ -1,8 +1,17 @@
 #ifndef DEF_H_INCLUDED
 #define DEF_H_INCLUDED
 
+#include <csignal>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include <sstream>
 #include <iostream>
@@ -10,6 +19,8 @@
 #include <bitset>
 #include <functional>
 #include <algorithm>
+#include <atomic>
+#include <deque>
 
 /**
  * Data Format
@@ -66,119 +77,331 @@ enum InstructionPurpose {
     INSTRUCTION_MOVE            ///< Instruction that moves values around Registers and Memory Locations
 };
 
-#include "memory_structure.h"
-#include "instruction.h"
-#include "execution_scope.h"
-#include "execution_interface.h"
+/**
+ * Operands of an Instruction, in the order they are written in the source text
+ */
+enum OperandLayout {
+    OPERANDS_INVALID,           ///< The Word is not a valid Instruction
+    OPERANDS_NONE,              ///< No Operands (syscall, break)
+    OPERANDS_RD_RS_RT,          ///< rd, rs, rt
+    OPERANDS_RD_RT_SHAMT,       ///< rd, rt, shamt
+    OPERANDS_RS,                ///< rs
+    OPERANDS_RD,                ///< rd
+    OPERANDS_RS_RT,             ///< rs, rt
+    OPERANDS_RT_RS_IMM,         ///< rt, rs, imm
+    OPERANDS_RT_IMM,            ///< rt, imm
+    OPERANDS_RT_OFFSET_BASE,    ///< rt, imm(rs)
+    OPERANDS_RS_RT_BRANCH,      ///< rs, rt, Branch Target
+    OPERANDS_JUMP               ///< Jump Target
+};
 
-extern bool isNumber(std::string s);
-extern bool isHex(std::string hexValue);
+/**
+ * What an Instruction does - the Handlers and every consumer of encoded Instructions are chosen by it
+ */
+enum InstructionKind {
+    KIND_INVALID,               ///< The Word is not a valid Instruction
+    KIND_REGISTER,              ///< R[rd] = Operation(R[rs], R[rt])
+    KIND_IMMEDIATE,             ///< R[rt] = Operation(R[rs], SignExtImm)
+    KIND_IMMEDIATE_UNSIGNED,    ///< R[rt] = Operation(R[rs], ZeroExtImm)
+    KIND_SHIFT,                 ///< R[rd] = Operation(R[rt], shamt)
+    KIND_LOAD_UPPER,            ///< R[rt] = {imm, 16'b0}
+    KIND_LOAD,                  ///< R[rt] = M[R[rs] + SignExtImm] (Bytes low Bytes of the Word)
+    KIND_STORE,                 ///< M[R[rs] + SignExtImm] = R[rt] (Bytes low Bytes of the Register)
+    KIND_LOAD_LINKED,           ///< R[rt] = M[R[rs] + SignExtImm], the Word is reserved
+    KIND_STORE_CONDITIONAL,     ///< M[R[rs] + SignExtImm] = R[rt] if the Word is still reserved, R[rt] = 1 / 0
+    KIND_SYNC,                  ///< Memory barrier
+    KIND_MULTIPLY_DIVIDE,       ///< {HI, LO} = Operation(R[rs], R[rt])
+    KIND_MOVE_FROM_HI,          ///< R[rd] = HI
+    KIND_MOVE_FROM_LO,          ///< R[rd] = LO
+    KIND_BRANCH,                ///< if(Condition(R[rs], R[rt])) { PC = PC + 4 + BranchAddr }
+    KIND_JUMP,                  ///< PC = JumpAddr
+    KIND_CALL,                  ///< R[31] = PC + 4; PC = JumpAddr
+    KIND_JUMP_REGISTER,         ///< PC = R[rs]
+    KIND_SYSCALL,               ///< Service selected by $v0
+    KIND_BREAK                  ///< Halt the Execution
+};
 
-extern int toDecimal(std::string binaryValue);
-extern int toDecimal(std::string inputValue, enum DataFormat inputFormat);
-extern std::string toBinary(const int decimalValue);
-extern std::string toHex(std::string binaryValue);
-extern std::string toHex(std::string binaryValue, const int hexSize);
+/**
+ * Extension of a 16-bit Immediate to a Word
+ */
+enum ImmediateExtension {
+    SIGN_EXTENSION,     ///< The bit 15 is copied to the upper Half-Word
+    ZERO_EXTENSION      ///< The upper Half-Word is 0
+};
 
-extern std::string toTwoComplement(const int decimalValue, const int binarySize);
-extern int fromTwoComplement(std::string binaryValue);
+/**
+ * Access Permissions of a Guest Memory Page
+ */
+enum PagePermission {
+    PAGE_NONE   = 0,    ///< Page cannot be accessed
+    PAGE_READ   = 1,    ///< Page can be read
+    PAGE_WRITE  = 2     ///< Page can be written
+};
+
+/**
+ * Reason why the Execution Scope stopped executing Instructions
+ */
+enum HaltReason {
+    NOT_HALTED,                 ///< The Execution Scope is running
+    HALT_EXIT,                  ///< The Guest called an Exit Syscall
+    HALT_BREAK,                 ///< The Guest executed a Break Instruction
+    HALT_END_OF_TEXT,           ///< The Program Counter left the Text Segment
+    HALT_INSTRUCTION_BUDGET,    ///< The maximum number of Instructions was executed
+    HALT_BREAKPOINT,            ///< The Program Counter reached a Breakpoint (the Execution can be resumed)
+    HALT_STEP,                  ///< The requested number of Instructions was executed (the Execution can be resumed)
+    HALT_WATCHPOINT,            ///< A Watchpoint stopped the Execution after the watched access (the Execution can be resumed)
+    HALT_INVALID_INSTRUCTION,   ///< The Word at the Program Counter is not a valid Instruction
+    HALT_INPUT                  ///< A read Syscall found no Input, it runs again when the Execution is resumed
+};
 
-extern std::string formatBinary(std::string binaryValue, const int binarySize);
-extern std::string formatHex(std::string hexValue, const int hexSize);
+/**
+ * Services of the Syscall Instruction (SPIM-compatible codes, selected by $v0)
+ */
+enum SyscallCode {
+    SYSCALL_PRINT_INT       = 1,    ///< Print the Integer in $a0
+    SYSCALL_PRINT_STRING    = 4,    ///< Print the null-terminated String at the Address in $a0
+    SYSCALL_READ_INT        = 5,    ///< Read an Integer into $v0
+    SYSCALL_READ_STRING     = 8,    ///< Read a String into the Buffer at $a0 of length $a1
+    SYSCALL_SBRK            = 9,    ///< Allocate $a0 Bytes of Dynamic Memory, the Address is returned in $v0
+    SYSCALL_EXIT            = 10,   ///< Terminate the Execution
+    SYSCALL_PRINT_CHAR      = 11,   ///< Print the Character in $a0
+    SYSCALL_READ_CHAR       = 12,   ///< Read a Character into $v0
+    SYSCALL_EXIT2           = 17    ///< Terminate the Execution with the Exit Code in $a0
+};
 
-extern std::string invertBinary(std::string binaryValue);
-extern std::string addBinary(std::string binaryA, std::string binaryB);
-extern std::string andBinary(std::string binaryA, std::string binaryB);
-extern std::string norBinary(std::string binaryA, std::string binaryB);
-extern std::string orBinary(std::string binaryA, std::string binaryB);
-extern std::string shiftLeftBinary(std::string binaryValue, std::string binaryShift);
-extern std::string shiftRightBinary(std::string binaryValue, std::string binaryShift);
-extern std::string subBinary(std::string binaryA, std::string binaryB);
+/**
+ * Accesses that trigger a Memory Watchpoint
+ */
+enum WatchType {
+    WATCH_READ      = 1,    ///< Triggered when the watched range is read
+    WATCH_WRITE     = 2,    ///< Triggered when the watched range is written
+    WATCH_ACCESS    = 3     ///< Triggered when the watched range is read or written
+};
 
-extern std::string SignExtImm(std::string immediate);
-extern std::string ZeroExtImm(std::string immediate);
-extern std::string BranchAddr(std::string immediate);
-extern std::string JumpAddr(std::string PC, std::string address);
+/**
+ * Backend used to store the Guest Memory
+ */
+enum MemoryBackend {
+    PAGED_MEMORY,   ///< Page Table behind a Software TLB
+    FAST_MEMORY     ///< Reservation of the whole 32-bit Guest Address Space (64-bit Linux hosts only)
+};
 
-extern void ADD_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void ADDI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void ADDIU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void ADDU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Amount of Execution done by each Engine between two comparisons of a Differential Execution
+ */
+enum StepGranularity {
+    STEP_INSTRUCTION,   ///< The Engines are compared after every Instruction
+    STEP_BLOCK          ///< The Engines are compared after every Block
+};
 
-extern void AND_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void ANDI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * What the Candidate Engine of a Differential Execution changes compared to the Reference Engine
+ */
+enum LockstepEngine {
+    LOCKSTEP_MEMORY,        ///< Same Engine on the other Memory Backend
+    LOCKSTEP_INTERPRETER    ///< Same Memory Backend, every Instruction decoded and executed on its own (no Fused Operations, no Translated Blocks)
+};
 
-extern void BEQ_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void BNE_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Part of the State where two Engines of a Differential Execution first disagreed
+ */
+enum DivergenceType {
+    NO_DIVERGENCE,          ///< The Engines agree
+    DIVERGENCE_HALT,        ///< The Engines stopped for different Reasons
+    DIVERGENCE_PC,          ///< The Program Counters differ
+    DIVERGENCE_REGISTER,    ///< A Register (or HI / LO) differs
+    DIVERGENCE_MEMORY       ///< A Word of the Guest Memory differs
+};
 
-extern void J_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void JAL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void JR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Direction of a Replay Log
+ */
+enum LogMode {
+    LOG_RECORD,         ///< The non-deterministic Inputs are appended to the Log
+    LOG_REPLAY          ///< The non-deterministic Inputs are read back from the Log
+};
 
-extern void LBU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void LHU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void LUI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void LW_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Type of a Record of the Replay Log
+ */
+enum LogRecordType {
+    LOG_END,            ///< No Record left (never written)
+    LOG_PROGRAM,        ///< Source lines of the Program
+    LOG_INPUT,          ///< Line read by an input Syscall
+    LOG_LOAD_WORDS,     ///< Words loaded by the host at the Global Pointer
+    LOG_LOAD_BYTES,     ///< Bytes loaded by the host at the Global Pointer
+    LOG_FILL,           ///< Repeated Word loaded by the host at the Global Pointer
+    LOG_HALT            ///< Final Halt of the Execution (Halt Reason, Instruction count, Exit Code)
+};
 
-extern void NOR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void OR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void ORI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * How the Execution leaves a Basic Block of the Control-Flow Graph
+ */
+enum BlockExit {
+    EXIT_FALLTHROUGH,   ///< The next Word is a Leader, the Execution continues there
+    EXIT_BRANCH,        ///< Conditional Branch (taken / not taken)
+    EXIT_JUMP,          ///< Direct Jump (j)
+    EXIT_CALL,          ///< Direct Call (jal), the Call returns to the next Word
+    EXIT_RETURN,        ///< Return (jr $ra)
+    EXIT_INDIRECT,      ///< Indirect Jump through another Register (jr), its targets are not resolved
+    EXIT_SYSCALL,       ///< Syscall, the Execution continues at the next Word unless it exits
+    EXIT_BREAK,         ///< Break, the Execution stops
+    EXIT_END_OF_TEXT,   ///< The Block runs to the end of the Text Segment
+    EXIT_INVALID        ///< The Block ends with a Word that is not a valid Instruction
+};
 
-extern void SLT_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SLTI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SLTIU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SLTU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Type of an Edge of the Control-Flow Graph
+ */
+enum EdgeType {
+    EDGE_FALLTHROUGH,   ///< The Execution continues at the next Word (Branch not taken, Syscall, Leader)
+    EDGE_TAKEN,         ///< Conditional Branch taken
+    EDGE_JUMP,          ///< Direct Jump
+    EDGE_CALL,          ///< Direct Call to a Function
+    EDGE_CALL_RETURN    ///< Return point of a Call (the Word following the jal)
+};
 
-extern void SLL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SRL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Idiom of a pair of Instructions executed as one Fused Operation
+ */
+enum FusionPattern {
+    FUSION_NONE,            ///< The Instructions are executed one by one
+    FUSION_LOAD_CONSTANT,   ///< lui + ori -> 32-bit Constant
+    FUSION_SCALED_INDEX,    ///< sll + addu -> Base + (Index << Scale)
+    FUSION_COMPARE_BRANCH,  ///< slt / sltu + bne / beq on the Comparison result
+    FUSION_COUNTED_LOOP     ///< addi / addiu $t, $t, imm + bne / beq on $t
+};
 
-extern void SB_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SH_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SW_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Operation of a Translated Block - the Operands are Slots of the block-local Register File,
+ * the Operation / Condition applied is the one of the Instruction Set row
+ */
+enum TranslatedOpcode {
+    TRANSLATED_NOP,                 ///< Label (sll $zero, $zero, 0)
+    TRANSLATED_REGISTER,            ///< dest = operation(left, right)
+    TRANSLATED_IMMEDIATE,           ///< dest = operation(left, immediate) (Extended Immediate / Shift amount)
+    TRANSLATED_LOAD_CONSTANT,       ///< dest = immediate
+    TRANSLATED_LOAD,                ///< dest = M[left + immediate] & valueMask
+    TRANSLATED_STORE,               ///< M[left + immediate] = right & valueMask
+    TRANSLATED_BRANCH,              ///< if(condition(left, right)) { PC = immediate }
+    TRANSLATED_JUMP                 ///< PC = immediate
+};
 
-extern void SUB_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void SUBU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Number of bits of the Guest Address used as Offset inside a Memory Page
+ */
+static const uint32_t pageBits = 12;
 
-extern void MUL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
-extern void DIV_function(ExecutionScope* executionScope, std::vector<std::string> funcParams);
+/**
+ * Size in Bytes of a Guest Memory Page
+ */
+static const uint32_t pageSize = 1u << pageBits;
+
+/**
+ * Number of Entries of each Software TLB (must be a power of two)
+ */
+static const uint32_t tlbEntries = 64;
+
+extern bool isNumber(const std::string& s);
+extern bool isHex(const std::string& hexValue);
+
+extern int toDecimal(const std::string& binaryValue);
+extern uint32_t toUnsigned(const std::string& binaryValue);
+extern uint32_t toWord(const std::string& binaryValue);
+extern int toDecimal(const std::string& inputValue, enum DataFormat inputFormat);
+extern std::string toBinary(const int decimalValue);
+extern std::string toHex(const std::string& binaryValue);
+extern std::string toHex(const std::string& binaryValue, const int hexSize);
+extern std::string haltReasonName(enum HaltReason haltReason);
+
+extern std::string toTwoComplement(const int decimalValue, const int binarySize);
+extern int fromTwoComplement(const std::string& binaryValue);
+
+extern std::string formatBinary(const std::string& binaryValue, const int binarySize);
+extern std::string formatHex(const std::string& hexValue, const int hexSize);
+
+extern std::string invertBinary(const std::string& binaryValue);
+extern std::string addBinary(const std::string& binaryA, const std::string& binaryB);
+extern std::string andBinary(const std::string& binaryA, const std::string& binaryB);
+extern std::string norBinary(const std::string& binaryA, const std::string& binaryB);
+extern std::string orBinary(const std::string& binaryA, const std::string& binaryB);
+extern std::string shiftLeftBinary(const std::string& binaryValue, const std::string& binaryShift);
+extern std::string shiftRightBinary(const std::string& binaryValue, const std::string& binaryShift);
+extern std::string subBinary(const std::string& binaryA, const std::string& binaryB);
+
+extern std::string SignExtImm(const std::string& immediate);
+extern std::string ZeroExtImm(const std::string& immediate);
+extern std::string BranchAddr(const std::string& immediate);
+extern std::string JumpAddr(const std::string& PC, const std::string& address);
+
+#include "guest_memory.h"
+#include "symbol_table.h"
+#include "execution_statistics.h"
+#include "guest_profiler.h"
+#include "macro_op_fusion.h"
+#include "block_translator.h"
+#include "memory_structure.h"
+#include "instruction.h"
+#include "execution_scope.h"
+#include "disassembler.h"
+#include "control_flow_graph.h"
+#include "perf_map.h"
+#include "replay_log.h"
+#include "differential_execution.h"
+#include "execution_interface.h"
+#include "aot_translator.h"
+#include "guest_machine.h"
+#include "guest_event_loop.h"
+
+extern void J_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void JAL_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void JR_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+extern void LUI_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+extern void LL_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void SC_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void SYNC_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+extern void MFHI_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void MFLO_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+extern void SYSCALL_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+extern void BREAK_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams);
+
+#include "isa_table.h"
+
+/**
+ * Fields of the Instruction, in the order they are written in the source text
+ *
+ * @hideinitializer
+ */
+static const std::map<enum OperandLayout, std::vector<std::string>> operandFields = {
+    { OPERANDS_NONE,            {}                      },
+    { OPERANDS_RD_RS_RT,        {"rd", "rs", "rt"}      },
+    { OPERANDS_RD_RT_SHAMT,     {"rd", "rt", "shamt"}   },
+    { OPERANDS_RS,              {"rs"}                  },
+    { OPERANDS_RD,              {"rd"}                  },
+    { OPERANDS_RS_RT,           {"rs", "rt"}            },
+    { OPERANDS_RT_RS_IMM,       {"rt", "rs", "imm"}     },
+    { OPERANDS_RT_IMM,          {"rt", "imm"}           },
+    { OPERANDS_RT_OFFSET_BASE,  {"rt", "imm", "rs"}     },
+    { OPERANDS_RS_RT_BRANCH,    {"rs", "rt", "imm"}     },
+    { OPERANDS_JUMP,            {"addr"}                }
+};
 
 /**
  * Match the Instruction's Name with the Memory Structure (that contains structural informations about the Instruction)
  *
  * @hideinitializer
  */
-static const std::map<std::string, MemoryStructure> instructionFormats = {
-    { "add",    MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "100000",   {"rd", "rs", "rt"},     ADD_function)   },
-    { "addi",   MemoryStructure(I_FORMAT, INSTRUCTION_MATHS,    "001000", "",         {"rt", "rs", "imm"},    ADDI_function)  },
-    { "addiu",  MemoryStructure(I_FORMAT, INSTRUCTION_MATHS,    "001001", "",         {"rt", "rs", "imm"},    ADDIU_function) },
-    { "addu",   MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "100001",   {"rd", "rs", "rt"},     ADDU_function)  },
-    { "and",    MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "100100",   {"rd", "rs", "rt"},     AND_function)   },
-    { "andi",   MemoryStructure(I_FORMAT, INSTRUCTION_LOGIC,    "001100", "",         {"rt", "rs", "imm"},    ANDI_function)  },
-    { "beq",    MemoryStructure(I_FORMAT, INSTRUCTION_ADDRESS,  "000100", "",         {"rs", "rt", "imm"},    BEQ_function)   },
-    { "bne",    MemoryStructure(I_FORMAT, INSTRUCTION_ADDRESS,  "000101", "",         {"rs", "rt", "imm"},    BNE_function)   },
-    { "j",      MemoryStructure(J_FORMAT, INSTRUCTION_ADDRESS,  "000010", "",         {"addr"},               J_function)     },
-    { "jal",    MemoryStructure(J_FORMAT, INSTRUCTION_ADDRESS,  "000011", "",         {"addr"},               JAL_function)   },
-    { "jr",     MemoryStructure(R_FORMAT, INSTRUCTION_ADDRESS,  "000000", "001000",   {"rs"},                 JR_function)    },
-    { "lbu",    MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "100100", "",         {"rt", "imm", "rs"},    LBU_function)   },
-    { "lhu",    MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "100101", "",         {"rt", "imm", "rs"},    LHU_function)   },
-    { "lui",    MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "001111", "",         {"rt", "imm"},          LUI_function)   },
-    { "lw",     MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "100011", "",         {"rt", "imm", "rs"},    LW_function)    },
-    { "nor",    MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "100111",   {"rd", "rs", "rt"},     NOR_function)   },
-    { "or",     MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "100101",   {"rd", "rs", "rt"},     OR_function)    },
-    { "ori",    MemoryStructure(I_FORMAT, INSTRUCTION_LOGIC,    "001101", "",         {"rt", "rs", "imm"},    ORI_function)   },
-    { "slt",    MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "101010",   {"rd", "rs", "rt"},     SLT_function)   },
-    { "slti",   MemoryStructure(I_FORMAT, INSTRUCTION_LOGIC,    "001010", "",         {"rt", "rs", "imm"},    SLTI_function)  },
-    { "sltiu",  MemoryStructure(I_FORMAT, INSTRUCTION_LOGIC,    "001011", "",         {"rt", "rs", "imm"},    SLTIU_function) },
-    { "sltu",   MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "101011",   {"rd", "rs", "rt"},     SLTU_function)  },
-    { "sll",    MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "000000",   {"rd", "rt", "shamt"},  SLL_function)   },
-    { "srl",    MemoryStructure(R_FORMAT, INSTRUCTION_LOGIC,    "000000", "000010",   {"rd", "rt", "shamt"},  SRL_function)   },
-    { "sb",     MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "101000", "",         {"rt", "imm", "rs"},    SB_function)    },
-    { "sh",     MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "101001", "",         {"rt", "imm", "rs"},    SH_function)    },
-    { "sw",     MemoryStructure(I_FORMAT, INSTRUCTION_MOVE,     "101011", "",         {"rt", "imm", "rs"},    SW_function)    },
-    { "sub",    MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "100010",   {"rd", "rs", "rt"},     SUB_function)   },
-    { "subu",   MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "100011",   {"rd", "rs", "rt"},     SUBU_function)  },
-    { "mul",    MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "010010",   {"rd", "rs", "rt"},     MUL_function)   },
-    { "div",    MemoryStructure(R_FORMAT, INSTRUCTION_MATHS,    "000000", "011010",   {"rd", "rs", "rt"},     DIV_function)   }
+static const std::map<std::string, MemoryStructure, std::less<>> instructionFormats = {
+    #define INSTRUCTION_FORMAT(mnemonic, format, purpose, opcode, funct, operands, kind, operation, bytes) \
+        { #mnemonic, MemoryStructure(format, purpose, opcode, funct, operandFields.at(operands), kindHandler<kind, operation, bytes>()) },
+
+    MIPS_INSTRUCTION_SET(INSTRUCTION_FORMAT)
+
+    #undef INSTRUCTION_FORMAT
 };
 
 /**
@@ -187,37 +410,12 @@ static const std::map<std::string, MemoryStructure> instructionFormats = {
  * @hideinitializer
  */
 static const std::map<std::pair<std::string, std::string>, std::string> instructionPointers {
-    { { "000000", "100000" },   "add"   },
-    { { "001000", ""       },   "addi"  },
-    { { "001001", ""       },   "addiu" },
-    { { "000000", "100001" },   "addu"  },
-    { { "000000", "100100" },   "and"   },
-    { { "001100", ""       },   "andi"  },
-    { { "000100", ""       },   "beq"   },
-    { { "000101", ""       },   "bne"   },
-    { { "000010", ""       },   "j"     },
-    { { "000011", ""       },   "jal"   },
-    { { "000000", "001000" },   "jr"    },
-    { { "100100", ""       },   "lbu"   },
-    { { "100101", ""       },   "lhu"   },
-    { { "001111", ""       },   "lui"   },
-    { { "100011", ""       },   "lw"    },
-    { { "000000", "100111" },   "nor"   },
-    { { "000000", "100101" },   "or"    },
-    { { "001101", ""       },   "ori"   },
-    { { "000000", "101010" },   "slt"   },
-    { { "001010", ""       },   "slti"  },
-    { { "001011", ""       },   "sltiu" },
-    { { "000000", "101011" },   "sltu"  },
-    { { "000000", "000000" },   "sll"   },
-    { { "000000", "000010" },   "srl"   },
-    { { "101000", ""       },   "sb"    },
-    { { "101001", ""       },   "sh"    },
-    { { "101011", ""       },   "sw"    },
-    { { "000000", "100010" },   "sub"   },
-    { { "000000", "100011" },   "subu"  },
-    { { "000000", "010010" },   "mul"   },
-    { { "000000", "011010" },   "div"   }
+    #define INSTRUCTION_POINTER(mnemonic, format, purpose, opcode, funct, operands, kind, operation, bytes) \
+        { { opcode, funct }, #mnemonic },
+
+    MIPS_INSTRUCTION_SET(INSTRUCTION_POINTER)
+
+    #undef INSTRUCTION_POINTER
 };
 
 /**
@@ -292,12 +490,23 @@ static const std::vector<std::string> registerPointers {
     "$gp", "$sp", "$fp", "$ra"
 };
 
+/**
+ * Register's 5-bit position, indexed by the Register number
+ *
+ * @hideinitializer
+ */
+static const std::string registerPositions[32] = {
+    "00000", "00001", "00010", "00011", "00100", "00101", "00110", "00111",
+    "01000", "01001", "01010", "01011", "01100", "01101", "01110", "01111",
+    "10000", "10001", "10010", "10011", "10100", "10101", "10110", "10111",
+    "11000", "11001", "11010", "11011", "11100", "11101", "11110", "11111"
+};
+
 /**
  * Initial value of the Program Counter
  */
 static const std::string startPC = formatBinary("10000000000000000000000", 32);
 
-
 /**
  * Initial value of the Global Area Pointer Register
  */
@@ -308,4 +517,56 @@ static const std::string startGP = formatBinary("10000000000001000000000000000",
  */
 static const std::string startSP = formatBinary("1111111111111111111111111111100", 32);
 
+/**
+ * Size in Bytes of the host-side Buffer that holds the Guest Output before it is flushed
+ */
+static const size_t outputBufferSize = 1 << 20;
+
+/**
+ * Initial Size in Bytes of the arena used to assemble the Instructions - it grows geometrically when a Program needs more
+ */
+static const size_t assemblyArenaSize = 1 << 16;
+
+/**
+ * Size in Bytes of the stack buffer that holds the Fields of the executed Instruction
+ */
+static const size_t instructionArenaSize = 2048;
+
+/**
+ * Size in Bytes of the Buffers used to write and read a Replay Log
+ */
+static const size_t logBufferSize = 1 << 16;
+
+/**
+ * Maximum depth of the Shadow Call Stack kept by the Guest Profiler (deeper Calls are not attributed)
+ */
+static const size_t maxCallDepth = 1024;
+
+/**
+ * Default Microseconds of CPU time between two Samples of the Guest Profiler
+ */
+static const uint32_t defaultSampleInterval = 1000;
+
+/**
+ * Slots of the block-local Register File of a Translated Block - an array on the host stack caching the Guest Registers in front of
+ * the String Register File of the Execution Scope. 32 Slots hold every Guest Register, so a Translation is never split for lack of Slots
+ * (a loop body using 22 Registers runs twice as fast as with 16 Slots); the Slot masks are 32-bit Words, so it cannot grow further
+ */
+static const uint32_t translationSlots = 32;
+
+/**
+ * Size in Bytes of the Stack of each Core of a Guest Machine (the Stack of Core N starts N Stacks below the initial Stack Pointer)
+ */
+static const uint32_t coreStackSize = 1 << 16;
+
+/**
+ * Default Instructions each Core of a Guest Machine runs per Quantum of the deterministic Scheduler
+ */
+static const uint64_t defaultQuantum = 10000;
+
+/**
+ * Default Instructions a Guest of an Event Loop runs before it goes back to the end of the Run Queue
+ */
+static const uint64_t defaultSliceLength = 1000;
+
 #endif // DEF_H_INCLUDED
@@ -0,0 +1,30 @@
+#ifndef PERF_MAP_H_INCLUDED
+#define PERF_MAP_H_INCLUDED
+
+#include "mips_emulator.h"
+
+#include <cstdio>
+
+/**
+ * Publishes the host code generated for the Guest to Linux perf - a perf map (/tmp/perf-<pid>.map) and, optionally, a jitdump (jit-<pid>.dump)
+ */
+class PerfMap {
+    public:
+        PerfMap(bool writeJitDump);
+        PerfMap(const PerfMap&) = delete;
+        ~PerfMap();
+
+        void addCode(const void* hostCode, size_t codeSize, const std::string& name);
+        void addBlock(const void* hostCode, size_t codeSize, uint32_t guestAddress, const SymbolTable& symbolTable);
+
+    private:
+        void writeDumpHeader();
+        static uint64_t getTimestamp();
+
+        FILE* mapFile = nullptr;                //perf map: one "<start> <size> <name>" line per code region
+        FILE* dumpFile = nullptr;               //jitdump: header followed by one JIT_CODE_LOAD record per code region
+        void* dumpMarker = nullptr;             //Executable mapping of the jitdump, perf finds the file through it
+        uint64_t codeIndex = 0;                 //Unique index of the next JIT_CODE_LOAD record
+};
+
+#endif // PERF_MAP_H_INCLUDED
@@ -0,0 +1,58 @@
+#ifndef REPLAY_LOG_H_INCLUDED
+#define REPLAY_LOG_H_INCLUDED
+
+#include "mips_emulator.h"
+
+#include <fstream>
+
+class ReplayLog {
+    public:
+        ReplayLog(const std::string& logPath, enum LogMode logMode);
+        ReplayLog(const ReplayLog&) = delete;
+        ~ReplayLog();
+
+        bool isOpen() const;
+        enum LogMode getMode() const;
+        void flush();
+
+        void recordProgram(const std::vector<std::string>& instructions);
+        void recordInput(const std::string& inputValue);
+        void recordWords(const uint32_t* wordValues, size_t wordCount);
+        void recordBytes(const uint8_t* byteValues, size_t byteCount);
+        void recordFill(uint32_t wordValue, size_t wordCount);
+        void recordHalt(enum HaltReason haltReason, uint64_t instructionCount, int exitCode);
+
+        enum LogRecordType peekRecord() const;
+        bool replayProgram(std::vector<std::string>& instructions);
+        bool replayInput(std::string& inputValue);
+        bool replayWords(std::vector<uint32_t>& wordValues);
+        bool replayBytes(std::vector<uint8_t>& byteValues);
+        bool replayFill(uint32_t& wordValue, uint64_t& wordCount);
+        bool replayHalt(enum HaltReason& haltReason, uint64_t& instructionCount, int& exitCode);
+
+    private:
+        void writeByte(uint8_t byteValue);
+        void writeNumber(uint64_t numberValue);
+        void writeData(const void* data, size_t size);
+
+        bool readByte(uint8_t& byteValue);
+        bool readNumber(uint64_t& numberValue);
+        bool readData(void* data, size_t size);
+        bool readString(std::string& stringValue);
+        bool beginRecord(enum LogRecordType recordType);
+        void fetchRecord();
+        bool truncateLog();
+
+        static const char logMagic[8];
+
+        enum LogMode logMode;
+        std::ofstream logOutput;
+        std::ifstream logInput;
+
+        std::vector<char> logBuffer;                    //Bytes waiting to be written / read but not yet decoded
+        size_t bufferPosition = 0;                      //Next Byte to decode (LOG_REPLAY only)
+
+        enum LogRecordType nextRecord = LOG_END;        //Type of the Record about to be replayed
+};
+
+#endif // REPLAY_LOG_H_INCLUDED
@@ -0,0 +1,57 @@
+#ifndef SYMBOL_TABLE_H_INCLUDED
+#define SYMBOL_TABLE_H_INCLUDED
+
+#include "mips_emulator.h"
+
+/**
+ * Symbol of the Symbol Table - the Name is interned in the Symbol Table's arena
+ */
+struct Symbol {
+    uint32_t address;   ///< Address of the Symbol
+    const char* name;   ///< Interned null-terminated Name of the Symbol
+};
+
+class SymbolTable {
+    public:
+        SymbolTable();
+        SymbolTable(const SymbolTable&) = delete;
+
+        void addSymbol(const std::string& name, uint32_t address);
+        bool findAddress(const std::string& name, uint32_t& address) const;
+        const char* findName(uint32_t address) const;
+        const char* findNearest(uint32_t address, uint32_t& symbolAddress) const;
+
+        const std::vector<Symbol>& getSymbols() const;
+        size_t size() const;
+
+    private:
+        /**
+         * Slot of the open-addressing Hash Map (empty when name is nullptr)
+         */
+        struct HashSlot {
+            const char* name;
+            uint32_t length;
+            uint32_t hash;
+            uint32_t address;
+        };
+
+        static uint32_t hashName(const char* name, size_t length);
+
+        size_t findSlot(const char* name, size_t length, uint32_t hash) const;
+        const char* internName(const char* name, size_t length);
+        void growHashMap();
+        void sortSymbols() const;
+
+        static const size_t arenaChunkSize = 1 << 16;
+
+        std::vector<std::unique_ptr<char[]>> arenaChunks;   //Interned Names
+        size_t arenaUsed = arenaChunkSize;                  //Bytes used in the last Chunk
+
+        std::vector<HashSlot> hashSlots;                    //Name -> Address (linear probing, capacity is a power of two)
+        size_t symbolCount = 0;
+
+        mutable std::vector<Symbol> sortedSymbols;          //Symbols sorted by Address (rebuilt lazily)
+        mutable bool symbolsSorted = true;
+};
+
+#endif // SYMBOL_TABLE_H_INCLUDED
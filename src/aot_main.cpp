@@ -0,0 +1,45 @@
+#include <iostream>
+#include <fstream>
+
+#include "../includes/mips_emulator.h"
+
+int main(int argc, char* argv[]) {
+    if(argc < 2) {
+        std::cout << "Usage: mips_aot <program> [output.cpp]" << std::endl;
+        return 1;
+    }
+
+    std::ifstream programInput(argv[1]);
+
+    if(!programInput) {
+        std::cout << "Program not readable!" << std::endl;
+        return 1;
+    }
+
+    /* Same input as the Console: one Instruction or Label per line, up to q */
+    std::vector<std::string> programLines;
+    std::string programLine;
+
+    while(std::getline(programInput, programLine) && programLine != "q" && programLine != "Q") {
+        programLines.push_back(programLine);
+    }
+
+    ExecutionScope executionScope(programLines);
+    AotTranslator translator(&executionScope, programLines);
+
+    if(argc < 3) {
+        translator.emit(std::cout);
+        return 0;
+    }
+
+    std::ofstream translationOutput(argv[2]);
+
+    if(!translationOutput) {
+        std::cout << "Translation Unit not writable!" << std::endl;
+        return 1;
+    }
+
+    translator.emit(translationOutput);
+
+    return 0;
+}
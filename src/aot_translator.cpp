@@ -0,0 +1,478 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Format a Word as a C++ unsigned Literal
+ *
+ * @param wordValue Word
+ * @return Literal 0xXXXXXXXXu
+ */
+static std::string toLiteral(uint32_t wordValue) {
+    char literal[16];
+    std::snprintf(literal, sizeof(literal), "0x%08Xu", wordValue);
+
+    return literal;
+}
+
+/**
+ * Format a Guest Register as a C++ expression
+ *
+ * @param regIndex Number of the Guest Register
+ * @return Expression context.registers[regIndex]
+ */
+static std::string toRegister(uint32_t regIndex) {
+    return "context.registers[" + std::to_string(regIndex) + "]";
+}
+
+/**
+ * Create the Context of a Program translated ahead of time
+ *
+ * @param executionScope Execution Scope holding the loaded Program
+ */
+AotContext::AotContext(ExecutionScope* executionScope) : executionScope(executionScope) {
+    this->textStart = executionScope->getTextStart();
+    this->textEnd = executionScope->getTextEnd();
+
+    this->loadRegisters();
+}
+
+/**
+ * Run the Program from the Program Counter of the Execution Scope until it halts -
+ * the Execution Scope gets the Registers and the Program Counter back at the end
+ *
+ * @param dispatcher Dispatcher of the generated Blocks
+ * @return Number of Instructions executed
+ */
+uint64_t AotContext::run(AotDispatcher dispatcher) {
+    uint32_t address = toUnsigned(this->executionScope->getPC());
+
+    while(!this->isHalted()) {
+        if(this->isTextModified) {
+            /* The generated Blocks hold the Instructions as they were loaded: the rewritten Program is left to the Execution Scope */
+            this->storeRegisters();
+            this->executionScope->setPC(address);
+
+            uint64_t countBefore = this->executionScope->getInstructionCount();
+            this->executionScope->run();
+            this->instructionCount += this->executionScope->getInstructionCount() - countBefore;
+
+            this->loadRegisters();
+            return this->instructionCount;
+        }
+
+        address = dispatcher(*this, address);
+    }
+
+    this->storeRegisters();
+    this->executionScope->setPC(address);
+
+    return this->instructionCount;
+}
+
+/**
+ * Load a Word with the checks of the Execution Scope, using the native $sp and $gp
+ *
+ * @param address Address of the Word
+ * @return Value of the Word
+ */
+uint32_t AotContext::loadWord(uint32_t address) {
+    uint32_t wordValue;
+    this->executionScope->checkedReadWord(address, this->registers[29], this->registers[28], wordValue);
+
+    return wordValue;
+}
+
+/**
+ * Store a Word with the checks of the Execution Scope
+ *
+ * @param address Address of the Word
+ * @param wordValue Value of the Word
+ * @return True if the Store rewrote the Text Segment (the generated Block must stop)
+ */
+bool AotContext::storeWord(uint32_t address, uint32_t wordValue) {
+    if(!this->executionScope->checkedWriteWord(address, wordValue) || address < this->textStart || address >= this->textEnd) {
+        return false;
+    }
+
+    this->isTextModified = true;
+
+    return true;
+}
+
+/**
+ * Load a Word and reserve it (ll) in the Execution Scope
+ *
+ * @param address Address of the Word
+ * @return Value of the Word
+ */
+uint32_t AotContext::loadLinked(uint32_t address) {
+    this->storeRegisters();
+
+    std::string wordValue = this->executionScope->loadLinked(toBinary(static_cast<int>(address)), "0");
+    return wordValue.size() ? toUnsigned(wordValue) : 0;
+}
+
+/**
+ * Store a Word if the Reservation still holds (sc) in the Execution Scope
+ *
+ * @param address Address of the Word
+ * @param wordValue Value of the Word
+ * @return 1 if the Word was stored, 0 if the Reservation was lost
+ */
+uint32_t AotContext::storeConditional(uint32_t address, uint32_t wordValue) {
+    if(!this->executionScope->storeConditional(toBinary(static_cast<int>(address)), "0", toBinary(static_cast<int>(wordValue)))) {
+        return 0;
+    }
+
+    if(address >= this->textStart && address < this->textEnd) {
+        this->isTextModified = true;
+    }
+
+    return 1;
+}
+
+/**
+ * Execute a Syscall in the Execution Scope
+ *
+ * @param address Address of the Syscall Instruction
+ */
+void AotContext::syscall(uint32_t address) {
+    this->storeRegisters();
+    this->executionScope->setPC(address);
+    this->executionScope->executeSyscall();
+    this->loadRegisters();
+}
+
+/**
+ * Stop the Execution
+ *
+ * @param haltReason Reason why the Execution stops
+ * @param address Address the Program Counter keeps
+ * @return Address the Program Counter keeps
+ */
+uint32_t AotContext::halt(enum HaltReason haltReason, uint32_t address) {
+    this->executionScope->halt(haltReason);
+
+    return address;
+}
+
+/**
+ * Execute one Instruction in the Execution Scope - used for the Addresses no generated Block starts at
+ * (indirect Jumps into the middle of a Block, invalid Words, the end of the Text Segment)
+ *
+ * @param address Address of the Instruction
+ * @return Address the Execution continues at
+ */
+uint32_t AotContext::interpret(uint32_t address) {
+    this->storeRegisters();
+    this->executionScope->setPC(address);
+
+    this->instructionCount += this->executionScope->step(1);
+
+    this->loadRegisters();
+
+    return toUnsigned(this->executionScope->getPC());
+}
+
+/**
+ * Publish the generated Blocks to Linux perf - the Blocks are emitted in their own Section, so each one ends
+ * where the next one (by host Address) or the Section starts
+ *
+ * @param perfMap perf map (and jitdump) the Blocks are written to
+ * @param blocks Generated Blocks
+ * @param blocksEnd End of the Section holding the Blocks
+ */
+void AotContext::publishBlocks(PerfMap& perfMap, const std::vector<AotBlock>& blocks, const void* blocksEnd) {
+    std::vector<uintptr_t> hostAddresses;
+    hostAddresses.reserve(blocks.size() + 1);
+
+    for(const AotBlock& block : blocks) {
+        hostAddresses.push_back(reinterpret_cast<uintptr_t>(block.hostCode));
+    }
+
+    hostAddresses.push_back(reinterpret_cast<uintptr_t>(blocksEnd));
+    std::sort(hostAddresses.begin(), hostAddresses.end());
+
+    for(const AotBlock& block : blocks) {
+        uintptr_t hostAddress = reinterpret_cast<uintptr_t>(block.hostCode);
+        auto nextAddress = std::upper_bound(hostAddresses.begin(), hostAddresses.end(), hostAddress);
+
+        if(nextAddress != hostAddresses.end()) {
+            perfMap.addBlock(reinterpret_cast<const void*>(hostAddress), *nextAddress - hostAddress, block.guestAddress, this->executionScope->getSymbolTable());
+        }
+    }
+}
+
+/**
+ * Copy the Registers of the Execution Scope into the Context
+ */
+void AotContext::loadRegisters() {
+    for(uint32_t regIndex = 0; regIndex < 32; regIndex++) {
+        this->registers[regIndex] = this->executionScope->getRegisterWord(regIndex);
+    }
+
+    this->HI = this->executionScope->getHI();
+    this->LO = this->executionScope->getLO();
+}
+
+/**
+ * Copy the Registers of the Context back into the Execution Scope
+ */
+void AotContext::storeRegisters() {
+    for(uint32_t regIndex = 0; regIndex < 32; regIndex++) {
+        this->executionScope->setRegisterWord(regIndex, this->registers[regIndex]);
+    }
+
+    this->executionScope->setHiLo(this->HI, this->LO);
+}
+
+/**
+ * Retrieves if the Execution stopped for good (a Step of the Execution Scope can be resumed)
+ *
+ * @return True if the Execution halted
+ */
+bool AotContext::isHalted() {
+    enum HaltReason haltReason = this->executionScope->getHaltReason();
+
+    return haltReason != NOT_HALTED && haltReason != HALT_STEP;
+}
+
+/**
+ * Create the Translator of a loaded Program
+ *
+ * @param executionScope Execution Scope holding the loaded Program
+ * @param programLines Source lines of the Program (embedded in the generated Translation Unit to load the same Memory)
+ */
+AotTranslator::AotTranslator(ExecutionScope* executionScope, const std::vector<std::string>& programLines)
+    : executionScope(executionScope), programLines(programLines), controlFlowGraph(executionScope) {
+}
+
+/**
+ * Emit the Translation Unit - the Program lines, one function per Basic Block, the Dispatcher and a main function
+ *
+ * @param output Stream the C++ source is written to
+ */
+void AotTranslator::emit(std::ostream& output) const {
+    output << "/* Generated by mips_aot: build against the mips_emulator Library */" << std::endl << std::endl;
+    output << "#include \"mips_emulator.h\"" << std::endl << std::endl;
+
+    /* The Blocks share one Section so that --perf-map can size them: the linker defines its end as __stop_mips_blocks */
+    output << "#define MIPS_BLOCK __attribute__((noinline, section(\"mips_blocks\"))) static uint32_t" << std::endl << std::endl;
+    output << "extern \"C\" __attribute__((weak)) const char __stop_mips_blocks[];" << std::endl << std::endl;
+
+    output << "static const std::vector<std::string> guestProgram = {" << std::endl;
+
+    for(const std::string& programLine : this->programLines) {
+        output << "    \"";
+
+        for(char lineCharacter : programLine) {
+            if(lineCharacter == '"' || lineCharacter == '\\') {
+                output << '\\';
+            }
+
+            output << lineCharacter;
+        }
+
+        output << "\"," << std::endl;
+    }
+
+    output << "};" << std::endl << std::endl;
+
+    for(const BasicBlock& basicBlock : this->controlFlowGraph.getBlocks()) {
+        this->emitBlock(basicBlock, output);
+    }
+
+    output << "static uint32_t dispatch(AotContext& context, uint32_t address) {" << std::endl;
+    output << "    switch(address) {" << std::endl;
+
+    for(const BasicBlock& basicBlock : this->controlFlowGraph.getBlocks()) {
+        char blockName[16];
+        std::snprintf(blockName, sizeof(blockName), "%08X", basicBlock.startAddress);
+
+        output << "        case " << toLiteral(basicBlock.startAddress) << ": return block_" << blockName << "(context);" << std::endl;
+    }
+
+    output << "        default: return context.interpret(address);" << std::endl;
+    output << "    }" << std::endl;
+    output << "}" << std::endl << std::endl;
+
+    output << "static const std::vector<AotBlock> guestBlocks = {" << std::endl;
+
+    for(const BasicBlock& basicBlock : this->controlFlowGraph.getBlocks()) {
+        char blockName[16];
+        std::snprintf(blockName, sizeof(blockName), "%08X", basicBlock.startAddress);
+
+        output << "    { " << toLiteral(basicBlock.startAddress) << ", block_" << blockName << " }," << std::endl;
+    }
+
+    output << "};" << std::endl << std::endl;
+
+    output << "int main(int argc, char* argv[]) {" << std::endl;
+    output << "    ExecutionScope executionScope(guestProgram);" << std::endl;
+    output << "    AotContext context(&executionScope);" << std::endl;
+    output << "    bool isRegistersPrinted = false;" << std::endl;
+    output << "    std::unique_ptr<PerfMap> perfMap;" << std::endl << std::endl;
+    output << "    for(int argIndex = 1; argIndex < argc; argIndex++) {" << std::endl;
+    output << "        std::string argument = argv[argIndex];" << std::endl << std::endl;
+    output << "        if(argument == \"--registers\") {" << std::endl;
+    output << "            isRegistersPrinted = true;" << std::endl;
+    output << "        } else if(argument == \"--perf-map\" || argument == \"--jitdump\") {" << std::endl;
+    output << "            perfMap = std::make_unique<PerfMap>(argument == \"--jitdump\");" << std::endl;
+    output << "        }" << std::endl;
+    output << "    }" << std::endl << std::endl;
+    output << "    if(perfMap) {" << std::endl;
+    output << "        context.publishBlocks(*perfMap, guestBlocks, __stop_mips_blocks);" << std::endl;
+    output << "    }" << std::endl << std::endl;
+    output << "    context.run(dispatch);" << std::endl;
+    output << "    executionScope.flushOutput();" << std::endl << std::endl;
+    output << "    if(isRegistersPrinted) {" << std::endl;
+    output << "        executionScope.printRegisters();" << std::endl;
+    output << "        std::cout << \"Instructions executed: \" << context.instructionCount << std::endl;" << std::endl;
+    output << "    }" << std::endl << std::endl;
+    output << "    return executionScope.getExitCode();" << std::endl;
+    output << "}" << std::endl;
+}
+
+/**
+ * Emit the function of a Basic Block - it runs the Instructions on the Context and returns the Address the Execution continues at
+ *
+ * @param basicBlock Basic Block
+ * @param output Stream the C++ source is written to
+ */
+void AotTranslator::emitBlock(const BasicBlock& basicBlock, std::ostream& output) const {
+    Disassembler disassembler(this->executionScope);
+    char insText[64];
+    char blockName[16];
+    std::snprintf(blockName, sizeof(blockName), "%08X", basicBlock.startAddress);
+
+    /* The invalid Word is counted by the Execution Scope when it runs it */
+    uint32_t instructionCount = (basicBlock.endAddress - basicBlock.startAddress) >> 2;
+    if(basicBlock.blockExit == EXIT_INVALID) {
+        instructionCount--;
+    }
+
+    output << "/* " << this->controlFlowGraph.getBlockName(basicBlock) << " */" << std::endl;
+    output << "MIPS_BLOCK block_" << blockName << "(AotContext& context) {" << std::endl;
+    output << "    context.instructionCount += " << instructionCount << ";" << std::endl << std::endl;
+
+    bool isReturned = false;
+
+    for(uint32_t insAddress = basicBlock.startAddress; insAddress < basicBlock.endAddress && !isReturned; insAddress += 4) {
+        uint32_t insValue = this->controlFlowGraph.getWord(insAddress);
+        const char* labelName = disassembler.findLabel(insAddress);
+
+        /* Label Words are NOPs, only their Name is kept */
+        if(insValue == 0 && labelName != nullptr) {
+            output << "    /* " << labelName << ": */" << std::endl;
+            continue;
+        }
+
+        size_t insLength = disassembler.disassemble(insValue, insAddress, insText, sizeof(insText));
+        output << "    /* " << toLiteral(insAddress).substr(0, 10) << ": " << std::string(insText, insLength) << " */" << std::endl;
+
+        isReturned = this->emitInstruction(insValue, insAddress, (basicBlock.endAddress - insAddress - 4) >> 2, output);
+    }
+
+    if(!isReturned) {
+        output << "    return " << toLiteral(basicBlock.endAddress) << ";" << std::endl;
+    }
+
+    output << "}" << std::endl << std::endl;
+}
+
+/**
+ * Emit the C++ statements of an Instruction - same semantics as its Instruction Handler
+ *
+ * @param insValue Value of the Instruction
+ * @param insAddress Address of the Instruction
+ * @param remainingCount Instructions of the Block after this one (not executed when a Store rewrites the Text Segment)
+ * @param output Stream the C++ source is written to
+ * @return True if the statements return from the Block function (control transfer, Break, invalid Word)
+ */
+bool AotTranslator::emitInstruction(uint32_t insValue, uint32_t insAddress, uint32_t remainingCount, std::ostream& output) const {
+    const InstructionInfo& instructionInfo = decodeInstruction(insValue);
+
+    std::string rs = toRegister(rsField(insValue));
+    std::string rt = toRegister(rtField(insValue));
+    std::string rd = toRegister(rdField(insValue));
+    std::string signImmediate = toLiteral(extendImmediate<SIGN_EXTENSION>(immediateField(insValue)));
+    std::string nextAddress = toLiteral(insAddress + 4);
+    std::string operationName = instructionInfo.operationName;
+    std::string valueMask = (instructionInfo.accessBytes < 4) ? " & " + toLiteral(accessMask(instructionInfo.accessBytes)) : "";
+
+    switch(instructionInfo.instructionKind) {
+        case KIND_INVALID:
+            output << "    return context.interpret(" << toLiteral(insAddress) << ");" << std::endl;
+            return true;
+        case KIND_REGISTER:
+            output << "    " << rd << " = " << operationName << "::apply(" << rs << ", " << rt << ");" << std::endl;
+            break;
+        case KIND_IMMEDIATE:
+            output << "    " << rt << " = " << operationName << "::apply(" << rs << ", " << signImmediate << ");" << std::endl;
+            break;
+        case KIND_IMMEDIATE_UNSIGNED:
+            output << "    " << rt << " = " << operationName << "::apply(" << rs << ", " << toLiteral(extendImmediate<ZERO_EXTENSION>(immediateField(insValue))) << ");" << std::endl;
+            break;
+        case KIND_SHIFT:
+            output << "    " << rd << " = " << operationName << "::apply(" << rt << ", " << shamtField(insValue) << ");" << std::endl;
+            break;
+        case KIND_LOAD_UPPER:
+            output << "    " << rt << " = " << toLiteral(immediateField(insValue) << 16) << ";" << std::endl;
+            break;
+        case KIND_LOAD:
+            output << "    " << rt << " = context.loadWord(" << rs << " + " << signImmediate << ")" << valueMask << ";" << std::endl;
+            break;
+        case KIND_STORE:
+            output << "    if(context.storeWord(" << rs << " + " << signImmediate << ", " << rt << valueMask << ")) {" << std::endl;
+            output << "        context.instructionCount -= " << remainingCount << ";" << std::endl;
+            output << "        return " << nextAddress << ";" << std::endl;
+            output << "    }" << std::endl;
+            break;
+        case KIND_LOAD_LINKED:
+            output << "    " << rt << " = context.loadLinked(" << rs << " + " << signImmediate << ");" << std::endl;
+            break;
+        case KIND_STORE_CONDITIONAL:
+            output << "    " << rt << " = context.storeConditional(" << rs << " + " << signImmediate << ", " << rt << ");" << std::endl;
+            break;
+        case KIND_SYNC:
+            output << "    std::atomic_thread_fence(std::memory_order_seq_cst);" << std::endl;
+            break;
+        case KIND_MULTIPLY_DIVIDE:
+            output << "    " << operationName << "::apply(" << rs << ", " << rt << ", context.HI, context.LO);" << std::endl;
+            break;
+        case KIND_MOVE_FROM_HI:
+            output << "    " << rd << " = context.HI;" << std::endl;
+            break;
+        case KIND_MOVE_FROM_LO:
+            output << "    " << rd << " = context.LO;" << std::endl;
+            break;
+        case KIND_BRANCH: {
+            uint32_t branchTarget = insAddress + 4 + (extendImmediate<SIGN_EXTENSION>(immediateField(insValue)) << 2);
+
+            output << "    return " << operationName << "::apply(" << rs << ", " << rt << ") ? " << toLiteral(branchTarget) << " : " << nextAddress << ";" << std::endl;
+            return true;
+        }
+        case KIND_JUMP:
+        case KIND_CALL: {
+            uint32_t jumpTarget = ((insAddress + 4) & 0xF0000000) | ((insValue & 0x03FFFFFF) << 2);
+
+            if(instructionInfo.instructionKind == KIND_CALL) {
+                output << "    " << toRegister(31) << " = " << nextAddress << ";" << std::endl;
+            }
+
+            output << "    return " << toLiteral(jumpTarget) << ";" << std::endl;
+            return true;
+        }
+        case KIND_JUMP_REGISTER:
+            output << "    return " << rs << ";" << std::endl;
+            return true;
+        case KIND_SYSCALL:
+            output << "    context.syscall(" << toLiteral(insAddress) << ");" << std::endl;
+            output << "    return " << nextAddress << ";" << std::endl;
+            return true;
+        case KIND_BREAK:
+            output << "    return context.halt(HALT_BREAK, " << toLiteral(insAddress) << ");" << std::endl;
+            return true;
+    }
+
+    return false;
+}
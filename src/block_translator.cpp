@@ -0,0 +1,389 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Find the Translated Opcode of a Kind of Instruction
+ *
+ * @param instructionKind Kind of the Instruction
+ * @param translatedOpcode Translated Opcode of the Kind (set only if it can be translated)
+ * @return False if the Instructions of the Kind must run in the Execution Scope
+ */
+static bool translateKind(enum InstructionKind instructionKind, enum TranslatedOpcode& translatedOpcode) {
+    switch(instructionKind) {
+        case KIND_REGISTER:
+            translatedOpcode = TRANSLATED_REGISTER;
+            return true;
+        case KIND_IMMEDIATE:
+        case KIND_IMMEDIATE_UNSIGNED:
+        case KIND_SHIFT:
+            translatedOpcode = TRANSLATED_IMMEDIATE;
+            return true;
+        case KIND_LOAD_UPPER:
+            translatedOpcode = TRANSLATED_LOAD_CONSTANT;
+            return true;
+        case KIND_LOAD:
+            translatedOpcode = TRANSLATED_LOAD;
+            return true;
+        case KIND_STORE:
+            translatedOpcode = TRANSLATED_STORE;
+            return true;
+        case KIND_BRANCH:
+            translatedOpcode = TRANSLATED_BRANCH;
+            return true;
+        case KIND_JUMP:
+            translatedOpcode = TRANSLATED_JUMP;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Find the Slot holding a Guest Register
+ *
+ * @param translatedBlock Translated Block
+ * @param guestRegister Number of the Guest Register
+ * @return Slot of the Guest Register, translationSlots if it has none
+ */
+static uint32_t findSlot(const TranslatedBlock& translatedBlock, uint8_t guestRegister) {
+    for(uint32_t slot = 0; slot < translatedBlock.slotCount; slot++) {
+        if(translatedBlock.slotRegisters[slot] == guestRegister) {
+            return slot;
+        }
+    }
+
+    return translationSlots;
+}
+
+/**
+ * Translate the Basic Blocks of the Text Segment
+ *
+ * @param controlFlowGraph Control-Flow Graph of the Text Segment
+ * @param textStart Address of the first Instruction
+ */
+void BlockTranslator::analyze(const ControlFlowGraph& controlFlowGraph, uint32_t textStart) {
+    const std::vector<BasicBlock>& basicBlocks = controlFlowGraph.getBlocks();
+
+    this->clear();
+    this->textStart = textStart;
+
+    if(basicBlocks.empty()) {
+        return;
+    }
+
+    this->blockIndexes.assign((basicBlocks.back().endAddress - textStart) >> 2, -1);
+
+    for(const BasicBlock& basicBlock : basicBlocks) {
+        uint32_t insAddress = basicBlock.startAddress;
+
+        while(insAddress < basicBlock.endAddress) {
+            TranslatedBlock translatedBlock = TranslatedBlock();
+            translatedBlock.startAddress = insAddress;
+            translatedBlock.stackSlot = translationSlots;
+            translatedBlock.globalSlot = translationSlots;
+
+            uint32_t writtenMask = 0;
+
+            while(insAddress < basicBlock.endAddress && this->translateInstruction(controlFlowGraph.getWord(insAddress), insAddress, translatedBlock, writtenMask)) {
+                insAddress += 4;
+            }
+
+            translatedBlock.endAddress = insAddress;
+            translatedBlock.dirtyMask = writtenMask;
+
+            if(translatedBlock.translatedOperations.empty()) {
+                /* The Instruction runs in the Execution Scope, the next Translation starts after it */
+                insAddress += 4;
+                continue;
+            }
+
+            enum TranslatedOpcode lastOpcode = translatedBlock.translatedOperations.back().translatedOpcode;
+            translatedBlock.endsBlock = (lastOpcode == TRANSLATED_BRANCH || lastOpcode == TRANSLATED_JUMP);
+
+            /* A single Instruction is cheaper to run in the Execution Scope than to load and store its Registers */
+            if(translatedBlock.translatedOperations.size() >= 2) {
+                this->blockIndexes[(translatedBlock.startAddress - textStart) >> 2] = static_cast<int32_t>(this->translatedBlocks.size());
+                this->translatedBlocks.push_back(std::move(translatedBlock));
+            }
+        }
+    }
+}
+
+/**
+ * Drop the Translations holding a Word of the Text Segment - called when the Word is overwritten
+ *
+ * @param address Address of the overwritten Word
+ */
+void BlockTranslator::invalidate(uint32_t address) {
+    for(const TranslatedBlock& translatedBlock : this->translatedBlocks) {
+        if(address >= translatedBlock.startAddress && address < translatedBlock.endAddress) {
+            this->blockIndexes[(translatedBlock.startAddress - this->textStart) >> 2] = -1;
+        }
+    }
+}
+
+/**
+ * Remove every Translation
+ */
+void BlockTranslator::clear() {
+    this->translatedBlocks.clear();
+    this->blockIndexes.clear();
+}
+
+/**
+ * Run a Translated Block - the Guest Registers are stored back and the Program Counter is set at the exit,
+ * or before the first Operation that must run in the Execution Scope (side exit)
+ *
+ * @param executionScope Execution Scope
+ * @param translatedBlock Translated Block starting at the Program Counter
+ * @return Number of Instructions executed (less than the Block length after a side exit)
+ */
+uint64_t BlockTranslator::execute(ExecutionScope* executionScope, const TranslatedBlock& translatedBlock) const {
+    const std::vector<TranslatedOperation>& translatedOperations = translatedBlock.translatedOperations;
+    uint32_t textStart = executionScope->getTextStart();
+    uint32_t textEnd = executionScope->getTextEnd();
+
+    uint32_t slots[translationSlots] = {};
+
+    for(uint32_t slot = 0; slot < translatedBlock.slotCount; slot++) {
+        if((translatedBlock.liveInMask >> slot) & 1) {
+            slots[slot] = executionScope->getRegisterWord(translatedBlock.slotRegisters[slot]);
+        }
+    }
+
+    uint32_t nextPC = translatedBlock.endAddress;
+    size_t opIndex = 0;
+    bool isSideExit = false;
+
+    for(; opIndex < translatedOperations.size(); opIndex++) {
+        const TranslatedOperation& translatedOperation = translatedOperations[opIndex];
+        uint32_t& dest = slots[translatedOperation.dest];
+        uint32_t left = slots[translatedOperation.left];
+        uint32_t right = slots[translatedOperation.right];
+
+        switch(translatedOperation.translatedOpcode) {
+            case TRANSLATED_NOP:
+                break;
+            case TRANSLATED_REGISTER:
+                dest = translatedOperation.operation(left, right);
+                break;
+            case TRANSLATED_IMMEDIATE:
+                dest = translatedOperation.operation(left, translatedOperation.immediate);
+                break;
+            case TRANSLATED_LOAD_CONSTANT:
+                dest = translatedOperation.immediate;
+                break;
+            case TRANSLATED_LOAD: {
+                uint32_t wordValue;
+                executionScope->checkedReadWord(left + translatedOperation.immediate, slots[translatedBlock.stackSlot], slots[translatedBlock.globalSlot], wordValue);
+
+                dest = wordValue & translatedOperation.valueMask;
+                break;
+            }
+            case TRANSLATED_STORE: {
+                uint32_t address = left + translatedOperation.immediate;
+
+                /* A Store to the Text Segment invalidates the Translations: it runs in the Execution Scope */
+                if(address % 4 == 0 && address >= textStart && address < textEnd) {
+                    isSideExit = true;
+                    break;
+                }
+
+                executionScope->checkedWriteWord(address, right & translatedOperation.valueMask);
+                break;
+            }
+            case TRANSLATED_BRANCH:
+                nextPC = translatedOperation.condition(left, right) ? translatedOperation.immediate : translatedBlock.endAddress;
+                break;
+            case TRANSLATED_JUMP:
+                nextPC = translatedOperation.immediate;
+                break;
+        }
+
+        if(isSideExit) {
+            break;
+        }
+    }
+
+    uint32_t writeBackMask = isSideExit ? translatedOperations[opIndex].dirtyMask : translatedBlock.dirtyMask;
+
+    for(uint32_t slot = 0; slot < translatedBlock.slotCount; slot++) {
+        if((writeBackMask >> slot) & 1) {
+            executionScope->setRegisterWord(translatedBlock.slotRegisters[slot], slots[slot]);
+        }
+    }
+
+    executionScope->setPC(isSideExit ? translatedOperations[opIndex].address : nextPC);
+
+    return opIndex;
+}
+
+/**
+ * Get the number of Translated Blocks
+ *
+ * @return Number of valid Translations
+ */
+size_t BlockTranslator::getBlockCount() const {
+    return std::count_if(this->blockIndexes.begin(), this->blockIndexes.end(), [](int32_t blockIndex) { return blockIndex >= 0; });
+}
+
+/**
+ * Get the number of Instructions covered by the Translated Blocks
+ *
+ * @return Number of Instructions of the valid Translations
+ */
+uint64_t BlockTranslator::getInstructionCount() const {
+    uint64_t instructionCount = 0;
+
+    for(int32_t blockIndex : this->blockIndexes) {
+        if(blockIndex >= 0) {
+            instructionCount += this->translatedBlocks[blockIndex].translatedOperations.size();
+        }
+    }
+
+    return instructionCount;
+}
+
+/**
+ * Append the Operation of an Instruction to a Translated Block - assigns the Slots of its Registers and tracks the live-in and written Slots
+ *
+ * @param insValue Value of the Instruction
+ * @param insAddress Address of the Instruction
+ * @param translatedBlock Translated Block the Operation is appended to
+ * @param writtenMask Slots written by the previous Operations (updated)
+ * @return False if the Instruction cannot be translated or its Registers do not fit in the free Slots (the Block is left unchanged)
+ */
+bool BlockTranslator::translateInstruction(uint32_t insValue, uint32_t insAddress, TranslatedBlock& translatedBlock, uint32_t& writtenMask) const {
+    TranslatedOperation translatedOperation = TranslatedOperation();
+    translatedOperation.address = insAddress;
+    translatedOperation.dirtyMask = writtenMask;
+
+    /* The Labels are stored as sll $zero, $zero, 0 */
+    if(insValue == 0) {
+        translatedOperation.translatedOpcode = TRANSLATED_NOP;
+        translatedBlock.translatedOperations.push_back(translatedOperation);
+
+        return true;
+    }
+
+    const InstructionInfo& instructionInfo = decodeInstruction(insValue);
+
+    if(!translateKind(instructionInfo.instructionKind, translatedOperation.translatedOpcode)) {
+        return false;
+    }
+
+    translatedOperation.operation = instructionInfo.operation;
+    translatedOperation.condition = instructionInfo.condition;
+
+    /* Guest Registers read (at most 3: the Loads also read $sp and $gp) and written by the Instruction */
+    uint8_t readRegisters[3];
+    uint32_t readCount = 0;
+    int writtenRegister = -1;
+
+    switch(instructionInfo.instructionKind) {
+        case KIND_SHIFT:
+            readRegisters[readCount++] = rtField(insValue);
+            writtenRegister = rdField(insValue);
+            translatedOperation.immediate = shamtField(insValue);
+            break;
+        case KIND_IMMEDIATE:
+            readRegisters[readCount++] = rsField(insValue);
+            writtenRegister = rtField(insValue);
+            translatedOperation.immediate = extendImmediate<SIGN_EXTENSION>(immediateField(insValue));
+            break;
+        case KIND_IMMEDIATE_UNSIGNED:
+            readRegisters[readCount++] = rsField(insValue);
+            writtenRegister = rtField(insValue);
+            translatedOperation.immediate = extendImmediate<ZERO_EXTENSION>(immediateField(insValue));
+            break;
+        case KIND_LOAD_UPPER:
+            writtenRegister = rtField(insValue);
+            translatedOperation.immediate = immediateField(insValue) << 16;
+            break;
+        case KIND_LOAD:
+            readRegisters[readCount++] = rsField(insValue);
+            readRegisters[readCount++] = 29;
+            readRegisters[readCount++] = 28;
+            writtenRegister = rtField(insValue);
+            translatedOperation.immediate = extendImmediate<SIGN_EXTENSION>(immediateField(insValue));
+            translatedOperation.valueMask = accessMask(instructionInfo.accessBytes);
+            break;
+        case KIND_STORE:
+            readRegisters[readCount++] = rsField(insValue);
+            readRegisters[readCount++] = rtField(insValue);
+            translatedOperation.immediate = extendImmediate<SIGN_EXTENSION>(immediateField(insValue));
+            translatedOperation.valueMask = accessMask(instructionInfo.accessBytes);
+            break;
+        case KIND_BRANCH:
+            readRegisters[readCount++] = rsField(insValue);
+            readRegisters[readCount++] = rtField(insValue);
+            translatedOperation.immediate = insAddress + 4 + (extendImmediate<SIGN_EXTENSION>(immediateField(insValue)) << 2);
+            break;
+        case KIND_JUMP:
+            translatedOperation.immediate = ((insAddress + 4) & 0xF0000000) | ((insValue & 0x03FFFFFF) << 2);
+            break;
+        default:
+            readRegisters[readCount++] = rsField(insValue);
+            readRegisters[readCount++] = rtField(insValue);
+            writtenRegister = rdField(insValue);
+            break;
+    }
+
+    /* Every Register of the Instruction needs a Slot: the Translation stops when the Register File is full */
+    uint32_t newRegisters = 0;
+    uint32_t seenMask = 0;
+
+    for(uint32_t readIndex = 0; readIndex < readCount; readIndex++) {
+        if(findSlot(translatedBlock, readRegisters[readIndex]) == translationSlots && !((seenMask >> readRegisters[readIndex]) & 1)) {
+            seenMask |= 1u << readRegisters[readIndex];
+            newRegisters++;
+        }
+    }
+
+    if(writtenRegister >= 0 && findSlot(translatedBlock, writtenRegister) == translationSlots && !((seenMask >> writtenRegister) & 1)) {
+        newRegisters++;
+    }
+
+    if(translatedBlock.slotCount + newRegisters > translationSlots) {
+        return false;
+    }
+
+    auto assignSlot = [&translatedBlock](uint8_t guestRegister) -> uint8_t {
+        uint32_t slot = findSlot(translatedBlock, guestRegister);
+
+        if(slot == translationSlots) {
+            slot = translatedBlock.slotCount++;
+            translatedBlock.slotRegisters[slot] = guestRegister;
+        }
+
+        return static_cast<uint8_t>(slot);
+    };
+
+    /* The Sources are read before the Destination is written: a Source not written yet by the Block is live-in */
+    uint8_t readSlots[3] = { 0, 0, 0 };
+
+    for(uint32_t readIndex = 0; readIndex < readCount; readIndex++) {
+        readSlots[readIndex] = assignSlot(readRegisters[readIndex]);
+
+        if(!((writtenMask >> readSlots[readIndex]) & 1)) {
+            translatedBlock.liveInMask |= 1u << readSlots[readIndex];
+        }
+    }
+
+    translatedOperation.left = readSlots[0];
+    translatedOperation.right = readSlots[1];
+
+    if(translatedOperation.translatedOpcode == TRANSLATED_LOAD) {
+        translatedBlock.stackSlot = readSlots[1];
+        translatedBlock.globalSlot = readSlots[2];
+        translatedOperation.right = 0;
+    }
+
+    if(writtenRegister >= 0) {
+        translatedOperation.dest = assignSlot(writtenRegister);
+        writtenMask |= 1u << translatedOperation.dest;
+    }
+
+    translatedBlock.translatedOperations.push_back(translatedOperation);
+
+    return true;
+}
@@ -0,0 +1,341 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Names of the Block Exits, indexed by BlockExit
+ */
+static const char* const exitNames[] = { "fallthrough", "branch", "jump", "call", "return", "indirect", "syscall", "break", "end of text", "invalid" };
+
+/**
+ * Control transfer done by a Word
+ */
+struct TransferInfo {
+    bool isValid;               ///< False if the Word is not a valid Instruction
+    bool isTransfer;            ///< True if the Word ends a Block
+    enum BlockExit blockExit;   ///< How the Execution leaves the Block ended by the Word
+    uint32_t targetAddress;     ///< Branch / Jump / Call target (EXIT_BRANCH, EXIT_JUMP, EXIT_CALL only)
+};
+
+/**
+ * Decode the control transfer done by a Word
+ *
+ * @param insValue Value of the Word
+ * @param insAddress Address of the Word
+ * @return Control transfer done by the Word
+ */
+static TransferInfo decodeTransfer(uint32_t insValue, uint32_t insAddress) {
+    TransferInfo transferInfo = { true, true, EXIT_FALLTHROUGH, 0 };
+    enum InstructionKind instructionKind = decodeInstruction(insValue).instructionKind;
+
+    /* The Blocks end where the Execution Scope ends them: after every Addressing Instruction */
+    switch(instructionKind) {
+        case KIND_INVALID:
+            transferInfo.isValid = false;
+            transferInfo.blockExit = EXIT_INVALID;
+            break;
+        case KIND_BRANCH:
+            transferInfo.blockExit = EXIT_BRANCH;
+            transferInfo.targetAddress = insAddress + 4 + (extendImmediate<SIGN_EXTENSION>(immediateField(insValue)) << 2);
+            break;
+        case KIND_JUMP:
+        case KIND_CALL:
+            transferInfo.blockExit = (instructionKind == KIND_JUMP) ? EXIT_JUMP : EXIT_CALL;
+            transferInfo.targetAddress = ((insAddress + 4) & 0xF0000000) | ((insValue & 0x03FFFFFF) << 2);
+            break;
+        case KIND_JUMP_REGISTER:
+            transferInfo.blockExit = (rsField(insValue) == 31) ? EXIT_RETURN : EXIT_INDIRECT;
+            break;
+        case KIND_SYSCALL:
+            transferInfo.blockExit = EXIT_SYSCALL;
+            break;
+        case KIND_BREAK:
+            transferInfo.blockExit = EXIT_BREAK;
+            break;
+        default:
+            transferInfo.isTransfer = false;
+            break;
+    }
+
+    return transferInfo;
+}
+
+/**
+ * ControlFlowGraph Constructor - builds the Graph of the Text Segment of the Execution Scope
+ *
+ * @param executionScope Execution Scope that holds the Instructions and the Labels
+ */
+ControlFlowGraph::ControlFlowGraph(ExecutionScope* executionScope) {
+    this->executionScope = executionScope;
+    this->textStart = executionScope->getTextStart();
+
+    uint32_t textEnd = executionScope->getTextEnd();
+    std::vector<uint8_t> pageData(pageSize);
+    uint32_t cachedPage = 0;
+    bool isPageCached = false;
+
+    for(uint32_t insAddress = this->textStart; insAddress < textEnd; insAddress += 4) {
+        if(!isPageCached || cachedPage != (insAddress >> pageBits)) {
+            cachedPage = insAddress >> pageBits;
+            isPageCached = true;
+            executionScope->getMemory().copyPage(cachedPage, pageData.data());
+        }
+
+        this->textWords.push_back(loadBigEndian(pageData.data() + (insAddress & (pageSize - 1))));
+    }
+
+    this->build();
+}
+
+/**
+ * Get the Basic Blocks
+ *
+ * @return Basic Blocks sorted by Address
+ */
+const std::vector<BasicBlock>& ControlFlowGraph::getBlocks() const {
+    return this->basicBlocks;
+}
+
+/**
+ * Get the Edges (the Edges of a Block are getEdges()[firstEdge, firstEdge + edgeCount))
+ *
+ * @return Edges grouped by source Block
+ */
+const std::vector<ControlFlowEdge>& ControlFlowGraph::getEdges() const {
+    return this->edges;
+}
+
+/**
+ * Get the Functions called by a jal
+ *
+ * @return Call targets inside the Text Segment, sorted
+ */
+const std::vector<uint32_t>& ControlFlowGraph::getCallTargets() const {
+    return this->callTargets;
+}
+
+/**
+ * Get the jr Instructions - their targets are only known at run time
+ *
+ * @return Addresses of the jr Instructions, sorted
+ */
+const std::vector<uint32_t>& ControlFlowGraph::getIndirectSites() const {
+    return this->indirectSites;
+}
+
+/**
+ * Find the Basic Block holding an Address
+ *
+ * @param address Address of an Instruction
+ * @return Basic Block holding the Instruction, nullptr outside the Text Segment
+ */
+const BasicBlock* ControlFlowGraph::findBlock(uint32_t address) const {
+    auto posBlock = std::upper_bound(this->basicBlocks.begin(), this->basicBlocks.end(), address,
+                                     [](uint32_t value, const BasicBlock& basicBlock) { return value < basicBlock.startAddress; });
+
+    if(posBlock == this->basicBlocks.begin() || address >= (posBlock - 1)->endAddress) {
+        return nullptr;
+    }
+
+    return &*(posBlock - 1);
+}
+
+/**
+ * Get a Word of the Text Segment as it was when the Graph was built
+ *
+ * @param address Address of the Word (inside the Text Segment)
+ * @return Value of the Word
+ */
+uint32_t ControlFlowGraph::getWord(uint32_t address) const {
+    return this->textWords[(address - this->textStart) >> 2];
+}
+
+/**
+ * Get the Name of a Basic Block - the nearest Label at or before its Leader ("loop", "loop+0x8"), or its Address
+ *
+ * @param basicBlock Basic Block
+ * @return Name of the Basic Block
+ */
+std::string ControlFlowGraph::getBlockName(const BasicBlock& basicBlock) const {
+    uint32_t symbolAddress;
+    const char* symbolName = this->executionScope->getSymbolTable().findNearest(basicBlock.startAddress, symbolAddress);
+
+    std::ostringstream nameStream;
+    nameStream << std::hex << std::uppercase;
+
+    if(symbolName != nullptr && symbolAddress >= this->textStart) {
+        nameStream << symbolName;
+
+        if(symbolAddress != basicBlock.startAddress) {
+            nameStream << "+0x" << (basicBlock.startAddress - symbolAddress);
+        }
+    } else {
+        nameStream << "0x" << std::setw(8) << std::setfill('0') << basicBlock.startAddress;
+    }
+
+    return nameStream.str();
+}
+
+/**
+ * Print the Graph in Graphviz DOT format - one node per Basic Block with its Disassembly
+ *
+ * @param output Stream the Graph is printed to
+ */
+void ControlFlowGraph::printDot(std::ostream& output) const {
+    static const char* const edgeStyles[] = {
+        "style=dashed",                 //EDGE_FALLTHROUGH
+        "color=darkgreen",              //EDGE_TAKEN
+        "",                             //EDGE_JUMP
+        "color=blue, style=bold",       //EDGE_CALL
+        "color=blue, style=dotted"      //EDGE_CALL_RETURN
+    };
+
+    Disassembler disassembler(this->executionScope);
+    const SymbolTable& symbolTable = this->executionScope->getSymbolTable();
+    char insText[maxDisassemblyLength];
+
+    output << "digraph cfg {" << std::endl;
+    output << "    node [shape=box, fontname=\"monospace\"];" << std::endl;
+
+    for(const BasicBlock& basicBlock : this->basicBlocks) {
+        output << "    b" << std::hex << basicBlock.startAddress << std::dec << " [label=\"" << this->getBlockName(basicBlock) << "\\l";
+
+        for(uint32_t insAddress = basicBlock.startAddress; insAddress < basicBlock.endAddress; insAddress += 4) {
+            const char* labelName = symbolTable.findName(insAddress);
+            std::string insLine;
+
+            /* Label Words are NOPs, they are printed as their Label */
+            if(labelName != nullptr) {
+                insLine = std::string(labelName) + ":";
+            } else {
+                size_t insLength = disassembler.disassemble(this->textWords[(insAddress - this->textStart) / 4], insAddress, insText, sizeof(insText));
+                insLine = "    " + std::string(insText, insLength);
+            }
+
+            for(char insCharacter : insLine) {
+                if(insCharacter == '"' || insCharacter == '\\') {
+                    output << '\\';
+                }
+
+                output << insCharacter;
+            }
+
+            output << "\\l";
+        }
+
+        output << "(" << exitNames[basicBlock.blockExit] << ")\\l\"];" << std::endl;
+    }
+
+    for(const ControlFlowEdge& edge : this->edges) {
+        output << "    b" << std::hex << edge.sourceAddress << " -> b" << edge.targetAddress << std::dec;
+
+        if(edgeStyles[edge.edgeType][0] != '\0') {
+            output << " [" << edgeStyles[edge.edgeType] << "]";
+        }
+
+        output << ";" << std::endl;
+    }
+
+    output << "}" << std::endl;
+}
+
+/**
+ * Build the Graph - the Leaders are the first Instruction, every Branch / Jump / Call target and every Word following a control transfer
+ * (targets outside the Text Segment halt the Execution: they get no Edge)
+ */
+void ControlFlowGraph::build() {
+    uint32_t wordCount = static_cast<uint32_t>(this->textWords.size());
+    uint32_t textEnd = this->textStart + 4 * wordCount;
+
+    std::vector<bool> isLeader(wordCount, false);
+    std::vector<TransferInfo> transfers(wordCount);
+
+    auto isInText = [this, textEnd](uint32_t address) {
+        return address >= this->textStart && address < textEnd && (address & 3) == 0;
+    };
+
+    if(wordCount) {
+        isLeader[0] = true;
+    }
+
+    for(uint32_t wordIndex = 0; wordIndex < wordCount; wordIndex++) {
+        uint32_t insAddress = this->textStart + 4 * wordIndex;
+        TransferInfo& transferInfo = transfers[wordIndex];
+        transferInfo = decodeTransfer(this->textWords[wordIndex], insAddress);
+
+        if(!transferInfo.isTransfer) {
+            continue;
+        }
+
+        if(wordIndex + 1 < wordCount) {
+            isLeader[wordIndex + 1] = true;
+        }
+
+        if(transferInfo.blockExit == EXIT_BRANCH || transferInfo.blockExit == EXIT_JUMP || transferInfo.blockExit == EXIT_CALL) {
+            if(isInText(transferInfo.targetAddress)) {
+                isLeader[(transferInfo.targetAddress - this->textStart) / 4] = true;
+            }
+
+            if(transferInfo.blockExit == EXIT_CALL) {
+                this->callTargets.push_back(transferInfo.targetAddress);
+            }
+        } else if(transferInfo.blockExit == EXIT_RETURN || transferInfo.blockExit == EXIT_INDIRECT) {
+            this->indirectSites.push_back(insAddress);
+        }
+    }
+
+    std::sort(this->callTargets.begin(), this->callTargets.end());
+    this->callTargets.erase(std::unique(this->callTargets.begin(), this->callTargets.end()), this->callTargets.end());
+
+    for(uint32_t wordIndex = 0; wordIndex < wordCount;) {
+        BasicBlock basicBlock;
+        basicBlock.startAddress = this->textStart + 4 * wordIndex;
+        basicBlock.firstEdge = static_cast<uint32_t>(this->edges.size());
+
+        /* The Block grows until a control transfer or until the next Leader */
+        while(!transfers[wordIndex].isTransfer && wordIndex + 1 < wordCount && !isLeader[wordIndex + 1]) {
+            wordIndex++;
+        }
+
+        const TransferInfo& transferInfo = transfers[wordIndex];
+        uint32_t lastAddress = this->textStart + 4 * wordIndex;
+        uint32_t nextAddress = lastAddress + 4;
+
+        basicBlock.endAddress = nextAddress;
+
+        if(transferInfo.isTransfer) {
+            basicBlock.blockExit = transferInfo.blockExit;
+        } else {
+            basicBlock.blockExit = (nextAddress < textEnd) ? EXIT_FALLTHROUGH : EXIT_END_OF_TEXT;
+        }
+
+        auto addEdge = [this, &basicBlock, &isInText](uint32_t targetAddress, enum EdgeType edgeType) {
+            if(isInText(targetAddress)) {
+                this->edges.push_back({ basicBlock.startAddress, targetAddress, edgeType });
+            }
+        };
+
+        switch(basicBlock.blockExit) {
+            case EXIT_FALLTHROUGH:
+            case EXIT_SYSCALL:
+                addEdge(nextAddress, EDGE_FALLTHROUGH);
+                break;
+            case EXIT_BRANCH:
+                addEdge(transferInfo.targetAddress, EDGE_TAKEN);
+                addEdge(nextAddress, EDGE_FALLTHROUGH);
+                break;
+            case EXIT_JUMP:
+                addEdge(transferInfo.targetAddress, EDGE_JUMP);
+                break;
+            case EXIT_CALL:
+                addEdge(transferInfo.targetAddress, EDGE_CALL);
+                addEdge(nextAddress, EDGE_CALL_RETURN);
+                break;
+            default:
+                break;
+        }
+
+        basicBlock.edgeCount = static_cast<uint32_t>(this->edges.size()) - basicBlock.firstEdge;
+        this->basicBlocks.push_back(basicBlock);
+
+        wordIndex++;
+    }
+}
@@ -0,0 +1,273 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Print a Word as an 8-digit Hexadecimal Value
+ *
+ * @param output Stream the Word is printed to
+ * @param wordValue Value of the Word
+ */
+static void printWord(std::ostream& output, uint32_t wordValue) {
+    std::ios_base::fmtflags outputFlags = output.flags();
+    char outputFill = output.fill();
+
+    output << "0x" << std::hex << std::uppercase << std::right << std::setw(8) << std::setfill('0') << wordValue;
+
+    output.flags(outputFlags);
+    output.fill(outputFill);
+}
+
+/**
+ * DifferentialExecution Constructor - starts tracking the Pages written by both Engines
+ *
+ * @param referenceScope Engine whose Execution is trusted
+ * @param candidateScope Engine checked against the Reference Engine
+ * @param stepGranularity Amount of Execution done by each Engine between two comparisons
+ */
+DifferentialExecution::DifferentialExecution(ExecutionScope* referenceScope, ExecutionScope* candidateScope, enum StepGranularity stepGranularity) {
+    this->referenceScope = referenceScope;
+    this->candidateScope = candidateScope;
+    this->stepGranularity = stepGranularity;
+
+    this->divergence = { NO_DIVERGENCE, 0, 0, 0, 0, 0, 0 };
+
+    this->referencePage.resize(pageSize);
+    this->candidatePage.resize(pageSize);
+
+    this->referenceScope->getMemory().trackDirtyPages(true);
+    this->candidateScope->getMemory().trackDirtyPages(true);
+}
+
+/**
+ * DifferentialExecution Destructor - stops tracking the Pages written by both Engines
+ */
+DifferentialExecution::~DifferentialExecution() {
+    this->referenceScope->getMemory().trackDirtyPages(false);
+    this->candidateScope->getMemory().trackDirtyPages(false);
+}
+
+/**
+ * Run both Engines in lockstep, comparing the Program Counter, the Registers and the Pages written after every Step
+ *
+ * @param maxSteps Maximum number of Steps (0 = until the Reference Engine halts)
+ * @return True if the Engines agreed on every Step, False when the first Divergence is found
+ */
+bool DifferentialExecution::run(uint64_t maxSteps) {
+    if(this->divergence.divergenceType != NO_DIVERGENCE) {
+        return false;
+    }
+
+    /* The first comparison covers the whole loaded State: every mapped Page starts dirty */
+    if(this->stepCount == 0) {
+        this->divergence.stepPC = toUnsigned(this->referenceScope->getPC());
+
+        if(!this->compareRegisters() || !this->compareMemory()) {
+            return false;
+        }
+    }
+
+    for(uint64_t stepIndex = 0; maxSteps == 0 || stepIndex < maxSteps; stepIndex++) {
+        enum HaltReason referenceHalt = this->referenceScope->getHaltReason();
+
+        if(referenceHalt != NOT_HALTED && referenceHalt != HALT_STEP) {
+            break;
+        }
+
+        this->divergence.stepIndex = this->stepCount++;
+        this->divergence.stepPC = toUnsigned(this->referenceScope->getPC());
+
+        /* The Candidate runs as many Instructions as the Reference Block: its own Blocks can end elsewhere (Translated Blocks, Fused Operations) */
+        if(this->stepGranularity == STEP_BLOCK) {
+            this->divergence.stepLength = this->referenceScope->stepBlock();
+
+            if(this->divergence.stepLength != 0) {
+                this->candidateScope->step(this->divergence.stepLength);
+
+                /* The Reference Block ran off the end of the Text Segment after its last Instruction: the Candidate finds it without executing anything */
+                uint32_t candidatePC = toUnsigned(this->candidateScope->getPC());
+
+                if(this->referenceScope->getHaltReason() == HALT_END_OF_TEXT && (candidatePC < this->candidateScope->getTextStart() || candidatePC >= this->candidateScope->getTextEnd())) {
+                    this->candidateScope->stepBlock();
+                }
+            } else {
+                this->candidateScope->stepBlock();
+            }
+        } else {
+            this->divergence.stepLength = this->referenceScope->step(1);
+            this->candidateScope->step(1);
+        }
+
+        uint32_t referenceValue = this->referenceScope->getHaltReason();
+        uint32_t candidateValue = this->candidateScope->getHaltReason();
+
+        if(referenceValue != candidateValue) {
+            this->divergence.divergenceType = DIVERGENCE_HALT;
+            this->divergence.referenceValue = referenceValue;
+            this->divergence.candidateValue = candidateValue;
+
+            return false;
+        }
+
+        referenceValue = toUnsigned(this->referenceScope->getPC());
+        candidateValue = toUnsigned(this->candidateScope->getPC());
+
+        if(referenceValue != candidateValue) {
+            this->divergence.divergenceType = DIVERGENCE_PC;
+            this->divergence.referenceValue = referenceValue;
+            this->divergence.candidateValue = candidateValue;
+
+            return false;
+        }
+
+        if(!this->compareRegisters() || !this->compareMemory()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Get the first Divergence found
+ *
+ * @return First Divergence (its type is NO_DIVERGENCE while the Engines agree)
+ */
+const Divergence& DifferentialExecution::getDivergence() const {
+    return this->divergence;
+}
+
+/**
+ * Get the Number of Steps executed in lockstep
+ *
+ * @return Number of Steps executed
+ */
+uint64_t DifferentialExecution::getStepCount() const {
+    return this->stepCount;
+}
+
+/**
+ * Print the first Divergence with the Disassembly of the Step that caused it
+ *
+ * @param output Stream the Divergence is printed to
+ */
+void DifferentialExecution::printDivergence(std::ostream& output) const {
+    const Divergence& divergence = this->divergence;
+
+    if(divergence.divergenceType == NO_DIVERGENCE) {
+        output << "No Divergence in " << this->stepCount << " Steps" << std::endl;
+        return;
+    }
+
+    if(divergence.stepLength == 0) {
+        output << "Divergence before the first Step (PC ";
+        printWord(output, divergence.stepPC);
+        output << "):" << std::endl;
+    } else {
+        output << "Divergence after Step " << divergence.stepIndex << " (" << divergence.stepLength << " Instructions from ";
+        printWord(output, divergence.stepPC);
+        output << "):" << std::endl;
+
+        Disassembler disassembler(this->referenceScope);
+        disassembler.disassemble(divergence.stepPC, divergence.stepPC + 4 * static_cast<uint32_t>(divergence.stepLength), output);
+    }
+
+    if(divergence.divergenceType == DIVERGENCE_HALT) {
+        output << "Halt Reason: reference " << haltReasonName(static_cast<enum HaltReason>(divergence.referenceValue)) << ", candidate "
+               << haltReasonName(static_cast<enum HaltReason>(divergence.candidateValue)) << std::endl;
+        return;
+    }
+
+    if(divergence.divergenceType == DIVERGENCE_PC) {
+        output << "Program Counter";
+    } else if(divergence.divergenceType == DIVERGENCE_REGISTER) {
+        output << "Register " << ((divergence.location < 32) ? registerPointers[divergence.location] : (divergence.location == 32) ? "$hi" : "$lo");
+    } else {
+        output << "Word at ";
+        printWord(output, divergence.location);
+    }
+
+    output << ": reference ";
+    printWord(output, divergence.referenceValue);
+    output << ", candidate ";
+    printWord(output, divergence.candidateValue);
+    output << std::endl;
+}
+
+/**
+ * Compare the Registers of both Engines
+ *
+ * @return True if the Registers are equal, otherwise return False (the Divergence is recorded)
+ */
+bool DifferentialExecution::compareRegisters() {
+    uint32_t referenceRegisters[stateRegisters];
+    uint32_t candidateRegisters[stateRegisters];
+
+    this->readRegisters(this->referenceScope, referenceRegisters);
+    this->readRegisters(this->candidateScope, candidateRegisters);
+
+    for(uint32_t regIndex = 0; regIndex < stateRegisters; regIndex++) {
+        if(referenceRegisters[regIndex] != candidateRegisters[regIndex]) {
+            this->divergence.divergenceType = DIVERGENCE_REGISTER;
+            this->divergence.location = regIndex;
+            this->divergence.referenceValue = referenceRegisters[regIndex];
+            this->divergence.candidateValue = candidateRegisters[regIndex];
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Compare the Pages written by either Engine since the last comparison - the Pages that were not written are still equal
+ *
+ * @return True if the written Pages are equal, otherwise return False (the Divergence is recorded)
+ */
+bool DifferentialExecution::compareMemory() {
+    this->dirtyPages.clear();
+    this->referenceScope->getMemory().collectDirtyPages(this->dirtyPages);
+    this->candidateScope->getMemory().collectDirtyPages(this->dirtyPages);
+
+    std::sort(this->dirtyPages.begin(), this->dirtyPages.end());
+    this->dirtyPages.erase(std::unique(this->dirtyPages.begin(), this->dirtyPages.end()), this->dirtyPages.end());
+
+    for(uint32_t pageNumber : this->dirtyPages) {
+        this->referenceScope->getMemory().copyPage(pageNumber, this->referencePage.data());
+        this->candidateScope->getMemory().copyPage(pageNumber, this->candidatePage.data());
+
+        if(std::memcmp(this->referencePage.data(), this->candidatePage.data(), pageSize) == 0) {
+            continue;
+        }
+
+        for(uint32_t pageOffset = 0; pageOffset < pageSize; pageOffset += 4) {
+            uint32_t referenceValue = loadBigEndian(this->referencePage.data() + pageOffset);
+            uint32_t candidateValue = loadBigEndian(this->candidatePage.data() + pageOffset);
+
+            if(referenceValue != candidateValue) {
+                this->divergence.divergenceType = DIVERGENCE_MEMORY;
+                this->divergence.location = (pageNumber << pageBits) | pageOffset;
+                this->divergence.referenceValue = referenceValue;
+                this->divergence.candidateValue = candidateValue;
+
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Read the Registers of an Engine
+ *
+ * @param executionScope Engine
+ * @param registerValues Array of stateRegisters Words (General Purpose Registers, HI, LO)
+ */
+void DifferentialExecution::readRegisters(ExecutionScope* executionScope, uint32_t* registerValues) {
+    for(uint32_t regIndex = 0; regIndex < 32; regIndex++) {
+        registerValues[regIndex] = toUnsigned(executionScope->getRegisterValue(std::bitset<5>(regIndex).to_string()));
+    }
+
+    registerValues[32] = executionScope->getHI();
+    registerValues[33] = executionScope->getLO();
+}
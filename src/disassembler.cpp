@@ -0,0 +1,216 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Register Names indexed by the Register Number
+ */
+static constexpr const char* registerNames[32] = {
+    "$zero", "$at",
+    "$v0", "$v1",
+    "$a0", "$a1", "$a2", "$a3",
+    "$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7",
+    "$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7",
+    "$t8", "$t9",
+    "$k0", "$k1",
+    "$gp", "$sp", "$fp", "$ra"
+};
+
+static constexpr char hexDigits[] = "0123456789ABCDEF";
+
+/**
+ * Bounded writer of a disassembled Instruction into a caller-supplied Buffer
+ */
+struct DisassemblyWriter {
+    char* position;
+    char* limit;
+
+    void put(char character) {
+        if(position < limit) *position++ = character;
+    }
+
+    void put(const char* text) {
+        while(*text && position < limit) *position++ = *text++;
+    }
+
+    void putRegister(uint32_t regIndex) {
+        this->put(registerNames[regIndex & 31]);
+    }
+
+    void putDecimal(int32_t decimalValue) {
+        char digits[12];
+        int digitCount = 0;
+        uint32_t absValue = (decimalValue < 0) ? 0u - static_cast<uint32_t>(decimalValue) : static_cast<uint32_t>(decimalValue);
+
+        do {
+            digits[digitCount++] = '0' + (absValue % 10);
+            absValue /= 10;
+        } while(absValue);
+
+        if(decimalValue < 0) this->put('-');
+        while(digitCount) this->put(digits[--digitCount]);
+    }
+
+    void putHex(uint32_t hexValue) {
+        this->put("0x");
+
+        for(int shift = 28; shift >= 0; shift -= 4) {
+            this->put(hexDigits[(hexValue >> shift) & 0xF]);
+        }
+    }
+};
+
+/**
+ * Disassembler Constructor
+ *
+ * @param executionScope Execution Scope that holds the Instructions and the Labels
+ */
+Disassembler::Disassembler(ExecutionScope* executionScope) : symbolTable(executionScope->getSymbolTable()) {
+    this->executionScope = executionScope;
+}
+
+/**
+ * Disassemble an Instruction into a Buffer - Branch and Jump targets are printed as Label names when a Label exists
+ *
+ * @param insValue Binary Value of the Instruction
+ * @param insAddress Address of the Instruction (used to calculate the Branch and Jump targets)
+ * @param buffer Buffer that receives the text of the Instruction (not null-terminated)
+ * @param bufferSize Size of the Buffer (maxDisassemblyLength is always enough)
+ * @return Number of characters written into the Buffer
+ */
+size_t Disassembler::disassemble(uint32_t insValue, uint32_t insAddress, char* buffer, size_t bufferSize) const {
+    DisassemblyWriter writer = { buffer, buffer + bufferSize };
+
+    uint32_t rs = (insValue >> 21) & 31;
+    uint32_t rt = (insValue >> 16) & 31;
+    uint32_t rd = (insValue >> 11) & 31;
+    int32_t immediate = static_cast<int16_t>(insValue & 0xFFFF);
+
+    const InstructionInfo& instructionInfo = decodeInstruction(insValue);
+
+    if(instructionInfo.operandLayout == OPERANDS_INVALID) {
+        writer.put(".word ");
+        writer.putHex(insValue);
+
+        return writer.position - buffer;
+    }
+
+    writer.put(instructionInfo.mnemonic);
+
+    if(instructionInfo.operandLayout != OPERANDS_NONE) {
+        writer.put(' ');
+    }
+
+    switch(instructionInfo.operandLayout) {
+        case OPERANDS_RD_RS_RT:
+            writer.putRegister(rd); writer.put(", "); writer.putRegister(rs); writer.put(", "); writer.putRegister(rt);
+            break;
+        case OPERANDS_RD_RT_SHAMT:
+            writer.putRegister(rd); writer.put(", "); writer.putRegister(rt); writer.put(", "); writer.putDecimal((insValue >> 6) & 31);
+            break;
+        case OPERANDS_RS:
+            writer.putRegister(rs);
+            break;
+        case OPERANDS_RD:
+            writer.putRegister(rd);
+            break;
+        case OPERANDS_RS_RT:
+            writer.putRegister(rs); writer.put(", "); writer.putRegister(rt);
+            break;
+        case OPERANDS_RT_RS_IMM:
+            writer.putRegister(rt); writer.put(", "); writer.putRegister(rs); writer.put(", "); writer.putDecimal(immediate);
+            break;
+        case OPERANDS_RT_IMM:
+            writer.putRegister(rt); writer.put(", "); writer.putDecimal(immediate);
+            break;
+        case OPERANDS_RT_OFFSET_BASE:
+            writer.putRegister(rt); writer.put(", "); writer.putDecimal(immediate); writer.put('('); writer.putRegister(rs); writer.put(')');
+            break;
+        case OPERANDS_RS_RT_BRANCH:
+        case OPERANDS_JUMP: {
+            uint32_t targetAddress;
+
+            if(instructionInfo.operandLayout == OPERANDS_JUMP) {
+                targetAddress = ((insAddress + 4) & 0xF0000000) | ((insValue & 0x03FFFFFF) << 2);
+            } else {
+                /* The Assembler encodes the Branch offset from the Branch itself (see BranchAddr) */
+                targetAddress = insAddress + (static_cast<uint32_t>(immediate) << 2);
+                writer.putRegister(rs); writer.put(", "); writer.putRegister(rt); writer.put(", ");
+            }
+
+            const char* labelName = this->findLabel(targetAddress);
+
+            if(labelName != nullptr) {
+                writer.put(labelName);
+            } else {
+                writer.putHex(targetAddress);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    return writer.position - buffer;
+}
+
+/**
+ * Disassemble a range of the Guest Memory - one line per Word ("Address:    Instruction"), Label Words are printed as their Label
+ *
+ * @param beginAddress Address of the first Word of the range
+ * @param endAddress Address following the last Word of the range
+ * @param output Stream that receives the disassembled lines
+ */
+void Disassembler::disassemble(uint32_t beginAddress, uint32_t endAddress, std::ostream& output) const {
+    static const size_t chunkSize = 1 << 16;
+    static const size_t lineLength = 16 + maxDisassemblyLength;
+
+    std::vector<char> chunk(chunkSize);
+    size_t chunkUsed = 0;
+
+    GuestMemory& memory = this->executionScope->getMemory();
+    const std::vector<Symbol>& labels = this->symbolTable.getSymbols();
+    auto posLabel = std::lower_bound(labels.begin(), labels.end(), beginAddress & ~3u,
+                                     [](const Symbol& symbol, uint32_t value) { return symbol.address < value; });
+
+    for(uint64_t address = beginAddress & ~3u; address < endAddress; address += 4) {
+        if(chunkUsed + lineLength > chunkSize) {
+            output.write(chunk.data(), chunkUsed);
+            chunkUsed = 0;
+        }
+
+        DisassemblyWriter writer = { chunk.data() + chunkUsed, chunk.data() + chunkUsed + lineLength - 1 };
+        writer.putHex(address);
+        writer.put(":    ");
+
+        while(posLabel != labels.end() && posLabel->address < address) posLabel++;
+
+        if(posLabel != labels.end() && posLabel->address == address) {
+            /* Several Labels can share an Address: the last defined one is printed */
+            auto lastLabel = posLabel;
+            while((lastLabel + 1) != labels.end() && (lastLabel + 1)->address == address) lastLabel++;
+
+            writer.put(lastLabel->name);
+            writer.put(':');
+        } else {
+            uint32_t insValue;
+            memory.readWord(address, insValue);
+
+            writer.position += this->disassemble(insValue, address, writer.position, writer.limit - writer.position);
+        }
+
+        *writer.position++ = '\n';
+        chunkUsed = writer.position - chunk.data();
+    }
+
+    output.write(chunk.data(), chunkUsed);
+}
+
+/**
+ * Find the Label defined at an Address
+ *
+ * @param address Address of the Label
+ * @return Name of the Label, nullptr if no Label is defined at the Address
+ */
+const char* Disassembler::findLabel(uint32_t address) const {
+    return this->symbolTable.findName(address);
+}
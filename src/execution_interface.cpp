@@ -1,10 +1,27 @@
 #include "../includes/execution_interface.h"
 
+#include <thread>
+
 /**
  * ExecutionInterface Constructor - initializes the Class
  */
 ExecutionInterface::ExecutionInterface() {
     this->executionScope = nullptr;
+    this->memoryBackend = PAGED_MEMORY;
+    this->sampleInterval = defaultSampleInterval;
+    this->sliceLength = defaultSliceLength;
+}
+
+/**
+ * ExecutionInterface Constructor - initializes the Class selecting the Memory Backend of the Execution Scope
+ *
+ * @param memoryBackend Backend used to store the Guest Memory
+ */
+ExecutionInterface::ExecutionInterface(enum MemoryBackend memoryBackend) {
+    this->executionScope = nullptr;
+    this->memoryBackend = memoryBackend;
+    this->sampleInterval = defaultSampleInterval;
+    this->sliceLength = defaultSliceLength;
 }
 
 /**
@@ -14,22 +31,101 @@ void ExecutionInterface::executeInterface() {
     std::string insAddress = startPC;
     std::string insValue = "";
 
-    std::cout << "Type the Instructions you want to Execute (Enter q to Quit):" << std::endl << std::endl;
+    if(this->replayLog != nullptr && this->replayLog->getMode() == LOG_REPLAY) {
+        if(!this->replayLog->replayProgram(this->instructions)) {
+            std::cout << "Replay Log does not start with a Program!" << std::endl;
+            return;
+        }
+    } else {
+        std::cout << "Type the Instructions you want to Execute (Enter q to Quit):" << std::endl << std::endl;
+
+        do {
+            std::cout << toHex(insAddress, 8) << ": ";
+            std::getline(std::cin, insValue);
+
+            if(insValue != "q" && insValue != "Q") {
+                insAddress = addBinary(insAddress, "100");
+                instructions.push_back(insValue);
+            }
+        } while(insValue != "q" && insValue != "Q");
+
+        if(this->replayLog != nullptr) {
+            this->replayLog->recordProgram(this->instructions);
+        }
+
+        this->clearScreen();
+    }
 
-    do {
-        std::cout << toHex(insAddress, 8) << ": ";
-        std::getline(std::cin, insValue);
+    if(this->coreCount > 1) {
+        this->executeMachine();
+        return;
+    }
 
-        if(insValue != "q" && insValue != "Q") {
-            insAddress = addBinary(insAddress, "100");
-            instructions.push_back(insValue);
+    if(this->guestCount > 1) {
+        this->executeLoops();
+        return;
+    }
+
+    executionScope = new ExecutionScope(this->instructions, this->memoryBackend);
+    executionScope->setInstructionBudget(this->instructionBudget);
+    executionScope->setReplayLog(this->replayLog);
+    executionScope->setFusion(this->fusionEnabled);
+    executionScope->setTranslation(this->translationEnabled);
+
+    if(this->graphPath != "") {
+        std::ofstream graphOutput(this->graphPath);
+
+        if(graphOutput) {
+            ControlFlowGraph(executionScope).printDot(graphOutput);
+        } else {
+            std::cout << "Control-Flow Graph not writable!" << std::endl;
         }
-    } while(insValue != "q" && insValue != "Q");
+    }
+
+    GuestProfiler profiler(toUnsigned(startPC));
+
+    if(this->profilePath != "") {
+        executionScope->setProfiler(&profiler);
+        profiler.start(this->sampleInterval);
+    }
+
+    if(this->lockstepEnabled) {
+        bool isInterpreter = (this->lockstepEngine == LOCKSTEP_INTERPRETER);
+        enum MemoryBackend candidateBackend = isInterpreter ? this->memoryBackend : (this->memoryBackend == PAGED_MEMORY) ? FAST_MEMORY : PAGED_MEMORY;
 
-    this->clearScreen();
+        ExecutionScope candidateScope(this->instructions, candidateBackend);
+        candidateScope.setInstructionBudget(this->instructionBudget);
+        candidateScope.setFusion(this->fusionEnabled && !isInterpreter);
+        candidateScope.setTranslation(this->translationEnabled && !isInterpreter);
+
+        /* The Guest Output is printed once, by the first Execution Scope */
+        candidateScope.setOutputCallback([](ExecutionScope*, const char*, size_t) {});
+
+        DifferentialExecution differentialExecution(executionScope, &candidateScope, this->lockstepGranularity);
+        differentialExecution.run(0);
+        differentialExecution.printDivergence(std::cout);
+    } else {
+        executionScope->executeScope();
+    }
+
+    if(this->profilePath != "") {
+        profiler.stop();
+        executionScope->setProfiler(nullptr);
+
+        std::ofstream profileOutput(this->profilePath);
+
+        if(profileOutput) {
+            profiler.printCollapsedStacks(executionScope->getSymbolTable(), profileOutput);
+        } else {
+            std::cout << "Profile not writable!" << std::endl;
+        }
+    }
 
-    executionScope = new ExecutionScope(this->instructions);
-    executionScope->executeScope();
+    if(executionScope->getHaltReason() == HALT_INSTRUCTION_BUDGET) {
+        std::cout << "Execution stopped: Instruction Budget exceeded (" << executionScope->getInstructionCount() << " Instructions executed)" << std::endl;
+    } else if(executionScope->getHaltReason() == HALT_BREAK) {
+        std::cout << "Execution stopped: Break at " << toHex(executionScope->getPC(), 8) << std::endl;
+    }
 
     std::cout << "Instructions:" << std::endl;
     executionScope->printInstructions(INSTRUCTION_VALUE);
@@ -42,6 +138,88 @@ void ExecutionInterface::executeInterface() {
 
     std::cout << std::endl << "Registers (Binary):" << std::endl;
     executionScope->printRegisters();
+
+    if(this->printStatistics) {
+        std::cout << std::endl << "Statistics:" << std::endl;
+        executionScope->printStatistics();
+    }
+}
+
+/**
+ * Set the maximum number of Instructions executed by the Execution Scope
+ *
+ * @param maxInstructions Maximum number of Instructions (0 = unlimited)
+ */
+void ExecutionInterface::setInstructionBudget(uint64_t maxInstructions) {
+    this->instructionBudget = maxInstructions;
+}
+
+/**
+ * Run a second Execution Scope in lockstep with the first one, reporting the first Divergence
+ *
+ * @param stepGranularity Amount of Execution done by each Execution Scope between two comparisons
+ * @param lockstepEngine What the second Execution Scope changes: the Memory Backend, or the Engine (plain Interpretation)
+ */
+void ExecutionInterface::setLockstep(enum StepGranularity stepGranularity, enum LockstepEngine lockstepEngine) {
+    this->lockstepEnabled = true;
+    this->lockstepGranularity = stepGranularity;
+    this->lockstepEngine = lockstepEngine;
+}
+
+/**
+ * Record the Program and its Inputs to a Replay Log, or replay them from it
+ *
+ * @param replayLog Replay Log (its Mode selects recording or replaying)
+ */
+void ExecutionInterface::setReplayLog(ReplayLog* replayLog) {
+    this->replayLog = replayLog;
+}
+
+/**
+ * Print the Instruction Mix of the Execution after its State
+ *
+ * @param printStatistics True to print the Instruction Mix
+ */
+void ExecutionInterface::setPrintStatistics(bool printStatistics) {
+    this->printStatistics = printStatistics;
+}
+
+/**
+ * Sample the Guest Call Stacks while executing and write them in collapsed-stack format
+ *
+ * @param profilePath File the collapsed Call Stacks are written to
+ * @param sampleInterval Microseconds of CPU time between two Samples
+ */
+void ExecutionInterface::setProfile(const std::string& profilePath, uint32_t sampleInterval) {
+    this->profilePath = profilePath;
+    this->sampleInterval = sampleInterval;
+}
+
+/**
+ * Write the Control-Flow Graph of the loaded Program in DOT format before executing it
+ *
+ * @param graphPath File the Control-Flow Graph is written to
+ */
+void ExecutionInterface::setGraphOutput(const std::string& graphPath) {
+    this->graphPath = graphPath;
+}
+
+/**
+ * Run the common pairs of Instructions (lui + ori, sll + addu, slt + branch, addi + branch) as Fused Operations
+ *
+ * @param fusionEnabled True to fuse the pairs, False to execute every Instruction on its own
+ */
+void ExecutionInterface::setFusion(bool fusionEnabled) {
+    this->fusionEnabled = fusionEnabled;
+}
+
+/**
+ * Run the straight-line Instructions of the Basic Blocks as Translated Blocks, with their Registers in a block-local Register File
+ *
+ * @param translationEnabled True to run the Translated Blocks, False to run every Instruction in the Execution Scope
+ */
+void ExecutionInterface::setTranslation(bool translationEnabled) {
+    this->translationEnabled = translationEnabled;
 }
 
 /**
@@ -54,3 +232,119 @@ void ExecutionInterface::clearScreen() {
          std::system ("cls");
     #endif
 }
+
+/**
+ * Run the Program on a Guest Machine of several Cores sharing the Guest Memory, one host thread per Core
+ *
+ * @param coreCount Number of Cores (1 = a single Execution Scope)
+ */
+void ExecutionInterface::setCores(uint32_t coreCount) {
+    this->coreCount = coreCount;
+}
+
+/**
+ * Run the Cores of the Guest Machine with the deterministic Scheduler - a Quantum of Instructions per Core and round on a pool of worker threads
+ *
+ * @param quantum Instructions each Core runs per round (0 = one free-running host thread per Core)
+ * @param workerCount Number of worker threads (0 = one per host CPU)
+ */
+void ExecutionInterface::setQuantum(uint64_t quantum, uint32_t workerCount) {
+    this->quantum = quantum;
+    this->workerCount = workerCount;
+}
+
+/**
+ * Run several copies of the Program cooperatively on Event Loops instead of a single Execution Scope
+ *
+ * @param guestCount Number of copies of the Program (1 = a single Execution Scope)
+ * @param loopCount Number of Event Loops, each one on its own host thread
+ * @param sliceLength Instructions a Guest runs per turn of its Event Loop
+ */
+void ExecutionInterface::setGuests(uint32_t guestCount, uint32_t loopCount, uint64_t sliceLength) {
+    this->guestCount = guestCount;
+    this->loopCount = loopCount;
+    this->sliceLength = sliceLength;
+}
+
+/**
+ * Run the copies of the Program on the Event Loops (Guest i goes to Loop i % Loops with $a0 = i), every Guest reads the lines
+ * that follow the Program up to the end of the Input - then print the Output and the Halt of each Guest
+ */
+void ExecutionInterface::executeLoops() {
+    std::vector<std::unique_ptr<GuestEventLoop>> eventLoops;
+    std::vector<std::string> inputLines;
+    std::string inputLine;
+
+    while(std::getline(std::cin, inputLine)) {
+        inputLines.push_back(inputLine);
+    }
+
+    for(uint32_t loopIndex = 0; loopIndex < std::max<uint32_t>(this->loopCount, 1); loopIndex++) {
+        eventLoops.emplace_back(new GuestEventLoop(this->sliceLength));
+    }
+
+    for(uint32_t guestIndex = 0; guestIndex < this->guestCount; guestIndex++) {
+        GuestEventLoop* eventLoop = eventLoops[guestIndex % eventLoops.size()].get();
+        uint32_t loopGuest = eventLoop->addGuest(this->instructions, this->memoryBackend);
+        ExecutionScope* guest = eventLoop->getGuest(loopGuest);
+
+        guest->setInstructionBudget(this->instructionBudget);
+        guest->setFusion(this->fusionEnabled);
+        guest->setTranslation(this->translationEnabled);
+        guest->setRegisterWord(4, guestIndex);
+
+        for(const std::string& guestInput : inputLines) {
+            eventLoop->provideInput(loopGuest, guestInput);
+        }
+    }
+
+    std::vector<std::thread> loopThreads;
+
+    for(std::unique_ptr<GuestEventLoop>& eventLoop : eventLoops) {
+        GuestEventLoop* loopPointer = eventLoop.get();
+        loopThreads.emplace_back([loopPointer]() { loopPointer->run(); });
+    }
+
+    for(std::thread& loopThread : loopThreads) {
+        loopThread.join();
+    }
+
+    for(uint32_t guestIndex = 0; guestIndex < this->guestCount; guestIndex++) {
+        GuestEventLoop* eventLoop = eventLoops[guestIndex % eventLoops.size()].get();
+        uint32_t loopGuest = guestIndex / static_cast<uint32_t>(eventLoops.size());
+        ExecutionScope* guest = eventLoop->getGuest(loopGuest);
+
+        std::cout << "Guest " << guestIndex << " (Halt " << haltReasonName(guest->getHaltReason()) << " at " << toHex(guest->getPC(), 8) << ", "
+                  << guest->getInstructionCount() << " Instructions executed"
+                  << (eventLoop->isWaiting(loopGuest) ? ", waiting for Input" : "") << "): " << eventLoop->getOutput(loopGuest) << std::endl;
+    }
+}
+
+/**
+ * Run the Program on every Core of a Guest Machine, then print the shared Memory and the State of each Core
+ */
+void ExecutionInterface::executeMachine() {
+    GuestMachine guestMachine(this->instructions, this->coreCount);
+
+    for(uint32_t coreIndex = 0; coreIndex < guestMachine.getCoreCount(); coreIndex++) {
+        ExecutionScope* core = guestMachine.getCore(coreIndex);
+
+        core->setInstructionBudget(this->instructionBudget);
+        core->setFusion(this->fusionEnabled);
+        core->setTranslation(this->translationEnabled);
+    }
+
+    if(this->quantum > 0) {
+        guestMachine.runQuanta(this->quantum, this->workerCount);
+    } else {
+        guestMachine.run();
+    }
+
+    std::cout << "Instructions:" << std::endl;
+    guestMachine.getCore(0)->printInstructions(INSTRUCTION_VALUE);
+
+    std::cout << std::endl << "Memory (Binary):" << std::endl;
+    guestMachine.getCore(0)->printMemory();
+
+    guestMachine.printCores();
+}
@@ -1,35 +1,66 @@
 #include "../includes/execution_scope.h"
 
+/**
+ * Serializes the Console accesses of the Execution Scopes running on different host threads (Cores of a Guest Machine)
+ */
+static std::mutex consoleLock;
+
+/**
+ * Bounds of the Memory the Loads can read (Stack: [$sp, stackTop), Text and Data: [textBase, $gp]) - compared as signed Integers, like the Registers
+ */
+static const int32_t stackTop = toDecimal(startSP);
+static const int32_t textBase = toDecimal(startPC);
+
 /**
  * ExecutionScope Constructor - Initializes the data structures used by the Execution Scope
  *
  * @param instructions List of Instructions to load into the Execution Scope
  */
-ExecutionScope::ExecutionScope(std::vector<std::string> instructions) {
+ExecutionScope::ExecutionScope(const std::vector<std::string>& instructions) : ExecutionScope(instructions, PAGED_MEMORY) {
+
+}
+
+/**
+ * ExecutionScope Constructor - Initializes the data structures used by the Execution Scope on the selected Memory Backend
+ *
+ * @param instructions List of Instructions to load into the Execution Scope
+ * @param memoryBackend Backend used to store the Guest Memory
+ */
+ExecutionScope::ExecutionScope(const std::vector<std::string>& instructions, enum MemoryBackend memoryBackend) : memory(memoryBackend) {
     this->setPC(startPC);
-    std::vector<Instruction*> instructionsParsed;
+
+    /* Every assembly-time allocation comes from the arena, which is freed in one shot at the end of the constructor */
+    std::pmr::monotonic_buffer_resource assemblyArena(assemblyArenaSize);
+    std::pmr::vector<Instruction> instructionsParsed(&assemblyArena);
+    instructionsParsed.reserve(instructions.size());
 
     for(unsigned int insIndex = 0; insIndex < instructions.size(); insIndex++) {
-        Instruction* instructionScope = new Instruction(instructions[insIndex], INSTRUCTION_VALUE, this);
-        instructionsParsed.push_back(instructionScope);
+        Instruction& instructionScope = instructionsParsed.emplace_back(instructions[insIndex], INSTRUCTION_VALUE, this, &assemblyArena);
 
-        if(instructionScope->getStatementType() == LABEL) {
-            std::string insAddress = toBinary(toDecimal(this->PC) + (insIndex * 4));
-            this->setLabelAddress(instructionScope->getName(), insAddress);
+        if(instructionScope.getStatementType() == LABEL) {
+            std::string insAddress = toBinary(this->PC + (insIndex * 4));
+            this->setLabelAddress(instructionScope.getName(), insAddress);
         }
     }
 
     for(unsigned int insIndex = 0; insIndex < instructionsParsed.size(); insIndex++) {
-        std::string insAddress = toBinary(toDecimal(this->PC) + (insIndex * 4));
+        std::string insAddress = toBinary(this->PC + (insIndex * 4));
 
-        instructionsParsed[insIndex]->setAddress(insAddress);
-        std::string insValue = instructionsParsed[insIndex]->calculateBinary();
+        instructionsParsed[insIndex].setAddress(insAddress);
+        std::string insValue = instructionsParsed[insIndex].calculateBinary();
 
-        this->setWordValue(insAddress, insValue);
+        /* Labels are stored as NOPs, their names are kept in the Label tables */
+        if(instructionsParsed[insIndex].getStatementType() == LABEL) {
+            insValue = "";
+        }
 
-        delete instructionsParsed[insIndex];
+        this->setWordValue(insAddress, insValue);
     }
 
+    this->textStart = this->PC;
+    this->textEnd = this->PC + (instructionsParsed.size() * 4);
+    this->breakpointBitmap.assign((instructionsParsed.size() + 63) / 64, 0);
+
     for(unsigned int regIndex = 0; regIndex < 32; regIndex++) {
         std::string regPosition = std::bitset<5>(regIndex).to_string();
         this->setRegisterValue(regPosition, "");
@@ -37,22 +68,654 @@ ExecutionScope::ExecutionScope(std::vector<std::string> instructions) {
 
     this->setRegisterValue("11100", startGP);
     this->setRegisterValue("11101", startSP);
+
+    this->outputBuffer.reserve(outputBufferSize);
+
+    ControlFlowGraph controlFlowGraph(this);
+    this->macroOpFusion.analyze(controlFlowGraph, this->textStart);
+    this->blockTranslator.analyze(controlFlowGraph, this->textStart);
+
+    this->memory.setWatchHandler([this](uint32_t address, uint32_t, bool, uint32_t oldValue, uint32_t newValue) {
+        this->hitWatchpoint(address, oldValue, newValue);
+    });
 }
 
 /**
- * Emulate the MIPS Execution Scope
+ * Emulate the MIPS Execution Scope - restarts from the first Instruction and runs until the Execution halts or a Breakpoint is hit
  */
 void ExecutionScope::executeScope() {
     this->setPC(startPC);
+    this->haltReason = NOT_HALTED;
+    this->isReserved = false;
+    this->instructionCount = 0;
+    this->statistics.reset();
+
+    if(this->profiler != nullptr) {
+        this->profiler->reset(this->PC);
+    }
+
+    this->runInstructions(UINT64_MAX, false);
+}
+
+/**
+ * Resume the Execution until it halts or a Breakpoint is hit
+ */
+void ExecutionScope::run() {
+    this->runInstructions(UINT64_MAX, true);
+}
+
+/**
+ * Resume the Execution for a number of Instructions (stops earlier if the Execution halts or a Breakpoint is hit)
+ *
+ * @param count Number of Instructions to execute
+ * @return Number of Instructions executed
+ */
+uint64_t ExecutionScope::step(uint64_t count) {
+    uint64_t executedCount = this->runInstructions(count, true);
+
+    if(executedCount == count && this->haltReason == NOT_HALTED) {
+        this->haltReason = HALT_STEP;
+    }
+
+    return executedCount;
+}
+
+/**
+ * Resume the Execution for one Block of Instructions (stops earlier if the Execution halts)
+ *
+ * @return Number of Instructions executed
+ */
+uint64_t ExecutionScope::stepBlock() {
+    uint64_t executedCount = this->runInstructions(UINT64_MAX, true, true);
+
+    if(this->haltReason == NOT_HALTED) {
+        this->haltReason = HALT_STEP;
+    }
+
+    return executedCount;
+}
+
+/**
+ * Resume the Execution until the Program Counter reaches the Address (stops earlier if the Execution halts or a Breakpoint is hit)
+ *
+ * @param address Address where the Execution stops
+ */
+void ExecutionScope::runUntil(uint32_t address) {
+    bool wasBreakpoint = this->isBreakpoint(address);
+
+    if(!wasBreakpoint && !this->addBreakpoint(address)) {
+        return;
+    }
+
+    this->untilAddress = address;
+    this->untilActive = true;
+
+    this->runInstructions(UINT64_MAX, true);
+
+    this->untilActive = false;
+
+    if(!wasBreakpoint) {
+        this->removeBreakpoint(address);
+    }
+}
+
+/**
+ * Resume the Execution until the Program Counter reaches the Label (stops earlier if the Execution halts or a Breakpoint is hit)
+ *
+ * @param label Label Name where the Execution stops
+ */
+void ExecutionScope::runUntil(const std::string& label) {
+    std::string labelAddress = this->getLabelAddress(label);
+
+    if(labelAddress != "") {
+        this->runUntil(toUnsigned(labelAddress) + 4);
+    }
+}
+
+/**
+ * Run Blocks of Instructions - the Breakpoints and the Instruction Budget are checked only at the Block boundaries
+ *
+ * @param maxInstructions Maximum number of Instructions to execute
+ * @param skipBreakpoint True to ignore a Breakpoint at the current Program Counter (it was already reported)
+ * @param singleBlock True to stop after the first Block
+ * @return Number of Instructions executed
+ */
+uint64_t ExecutionScope::runInstructions(uint64_t maxInstructions, bool skipBreakpoint, bool singleBlock) {
+    uint64_t executedCount = 0;
+
+    if(this->haltReason == HALT_BREAKPOINT || this->haltReason == HALT_STEP || this->haltReason == HALT_INSTRUCTION_BUDGET || this->haltReason == HALT_WATCHPOINT ||
+       this->haltReason == HALT_INPUT) {
+        this->haltReason = NOT_HALTED;
+    }
+
+    bool wasRunning = (this->haltReason == NOT_HALTED);
+
+    if(this->replayLog != nullptr && this->replayLog->getMode() == LOG_REPLAY) {
+        this->replayLoads();
+    }
+
+    while(this->haltReason == NOT_HALTED && executedCount < maxInstructions) {
+        if(this->breakpointCount && !skipBreakpoint && this->isBreakpoint(this->PC) && !this->hitBreakpoint()) {
+            break;
+        }
+
+        skipBreakpoint = false;
+
+        uint32_t blockStart = this->PC;
+        uint64_t blockLength = this->executeBlock(maxInstructions - executedCount);
+        executedCount += blockLength;
+        this->instructionCount += blockLength;
+
+        if(blockLength) {
+            this->statistics.countBlock(blockStart, blockLength, this->PC);
+        }
+
+        /* The Timer only sets a flag: the Sample is taken here, between two Blocks */
+        if(this->profiler != nullptr && GuestProfiler::isSamplePending()) {
+            this->profiler->takeSample(this->PC);
+        }
+
+        /* The Budget is checked once per Block, it can be exceeded by at most one Block */
+        if(this->instructionBudget && this->instructionCount >= this->instructionBudget && this->haltReason == NOT_HALTED) {
+            this->halt(HALT_INSTRUCTION_BUDGET);
+        }
+
+        if(singleBlock) {
+            break;
+        }
+    }
+
+    this->flushOutput();
+
+    /* Only the final Halt is logged, the resumable ones depend on how the host drives the Execution */
+    if(this->replayLog != nullptr && wasRunning && (this->haltReason == HALT_EXIT || this->haltReason == HALT_BREAK ||
+                                                    this->haltReason == HALT_END_OF_TEXT || this->haltReason == HALT_INVALID_INSTRUCTION)) {
+        this->logHalt();
+    }
+
+    return executedCount;
+}
+
+/**
+ * Apply the Loads recorded before the next Input or Halt of the Log
+ */
+void ExecutionScope::replayLoads() {
+    std::vector<uint32_t> wordValues;
+    std::vector<uint8_t> byteValues;
+    uint32_t fillValue;
+    uint64_t fillCount;
+
+    while(true) {
+        enum LogRecordType recordType = this->replayLog->peekRecord();
+
+        if(recordType == LOG_LOAD_WORDS && this->replayLog->replayWords(wordValues)) {
+            this->storeWords(wordValues.data(), wordValues.size());
+        } else if(recordType == LOG_LOAD_BYTES && this->replayLog->replayBytes(byteValues)) {
+            this->storeBytes(byteValues.data(), byteValues.size());
+        } else if(recordType == LOG_FILL && this->replayLog->replayFill(fillValue, fillCount)) {
+            this->storeFill(fillValue, fillCount);
+        } else {
+            break;
+        }
+    }
+}
+
+/**
+ * Record the final Halt of the Execution, or check it against the Log while replaying
+ */
+void ExecutionScope::logHalt() {
+    if(this->replayLog->getMode() == LOG_RECORD) {
+        this->replayLog->recordHalt(this->haltReason, this->instructionCount, this->exitCode);
+        return;
+    }
+
+    enum HaltReason recordedHalt;
+    uint64_t recordedCount;
+    int recordedExitCode;
+
+    if(!this->replayLog->replayHalt(recordedHalt, recordedCount, recordedExitCode)) {
+        std::cout << "Replay diverged: no Halt recorded!" << std::endl;
+    } else if(recordedHalt != this->haltReason || recordedCount != this->instructionCount || recordedExitCode != this->exitCode) {
+        std::cout << "Replay diverged: recorded Halt " << haltReasonName(recordedHalt) << " after " << recordedCount << " Instructions, replayed Halt "
+                  << haltReasonName(this->haltReason) << " after " << this->instructionCount << " Instructions!" << std::endl;
+    }
+}
+
+/**
+ * Attach a Replay Log - the non-deterministic Inputs (Input Syscalls, host Loads) are recorded to it or replayed from it
+ *
+ * @param replayLog Replay Log (nullptr to detach the Log)
+ */
+void ExecutionScope::setReplayLog(ReplayLog* replayLog) {
+    this->replayLog = replayLog;
+}
+
+/**
+ * Attach a Sampling Profiler - its Shadow Call Stack follows the jal / jr $ra Instructions and a Sample is taken at the Block boundary following each Timer tick
+ *
+ * @param profiler Profiler (nullptr to stop profiling)
+ */
+void ExecutionScope::setProfiler(GuestProfiler* profiler) {
+    this->profiler = profiler;
+}
+
+/**
+ * Enable or disable the Fused Operations - when disabled every Instruction is decoded and executed on its own
+ *
+ * @param fusionEnabled True to run the Fused Operations
+ */
+void ExecutionScope::setFusion(bool fusionEnabled) {
+    this->fusionEnabled = fusionEnabled;
+}
+
+/**
+ * Enable or disable the Translated Blocks - when disabled the Instructions are run by the Fused Operations or one by one
+ *
+ * @param translationEnabled True to run the Translated Blocks
+ */
+void ExecutionScope::setTranslation(bool translationEnabled) {
+    this->translationEnabled = translationEnabled;
+}
+
+/**
+ * Execute a Block of Instructions - the Block ends after a control transfer (Branch / Jump / Syscall / Break), before a Breakpoint or at the end of the Text Segment
+ *
+ * @param maxLength Maximum number of Instructions of the Block
+ * @return Number of Instructions executed
+ */
+uint64_t ExecutionScope::executeBlock(uint64_t maxLength) {
+    uint64_t blockLength = 0;
+
+    /* The Fields of the executed Instruction live in a stack buffer that is reset after every Instruction */
+    alignas(std::max_align_t) char instructionBuffer[instructionArenaSize];
+    std::pmr::monotonic_buffer_resource instructionArena(instructionBuffer, sizeof(instructionBuffer));
+
+    while(this->haltReason == NOT_HALTED && blockLength < maxLength) {
+        if(this->PC < this->textStart || this->PC >= this->textEnd) {
+            this->halt(HALT_END_OF_TEXT);
+            break;
+        }
+
+        /* A Translated Block runs when it fits in the Block and nothing can stop the Execution inside it (Breakpoint, Watchpoint) */
+        if(this->translationEnabled && this->watchpointCount == 0) {
+            const TranslatedBlock* translatedBlock = this->blockTranslator.find(this->PC);
+
+            if(translatedBlock != nullptr && translatedBlock->translatedOperations.size() <= maxLength - blockLength &&
+               !(this->breakpointCount && this->isBreakpointInRange(translatedBlock->startAddress + 4, translatedBlock->endAddress))) {
+                uint64_t translatedLength = this->blockTranslator.execute(this, *translatedBlock);
+                blockLength += translatedLength;
+
+                if(translatedLength == translatedBlock->translatedOperations.size()) {
+                    if(translatedBlock->endsBlock || (this->breakpointCount && this->isBreakpoint(this->PC))) {
+                        break;
+                    }
+
+                    continue;
+                }
+
+                /* Side exit: the Instruction at the Program Counter runs below */
+            }
+        }
+
+        uint32_t insValue;
+        this->memory.readWord(this->PC, insValue);
+
+        /* A pair runs as one Fused Operation unless its Words were overwritten, a Breakpoint splits it or the Block has room for one Instruction only */
+        if(this->fusionEnabled && maxLength - blockLength >= 2) {
+            const FusedOperation* fusedOperation = this->macroOpFusion.find(this->PC);
+            uint32_t secondValue;
 
-    while(!this->isFinished()) {
-        std::string insValue = this->getWordValue(this->PC);
+            if(fusedOperation != nullptr && fusedOperation->firstWord == insValue && this->memory.readWord(this->PC + 4, secondValue) &&
+               fusedOperation->secondWord == secondValue && !(this->breakpointCount && this->isBreakpoint(this->PC + 4))) {
+                fusedOperation->fusedHandler(this, *fusedOperation);
+                blockLength += 2;
 
-        Instruction* instructionScope = new Instruction(insValue, BINARY_VALUE, this);
-        instructionScope->executeInstruction();
+                if(fusedOperation->endsBlock || (this->breakpointCount && this->isBreakpoint(this->PC))) {
+                    break;
+                }
 
-        delete instructionScope;
+                continue;
+            }
+        }
+
+        enum InstructionPurpose instructionPurpose;
+
+        {
+            Instruction instructionScope(toBinary(insValue), BINARY_VALUE, this, &instructionArena);
+            instructionScope.executeInstruction();
+
+            instructionPurpose = instructionScope.getInstructionPurpose();
+        }
+
+        instructionArena.release();
+
+        /* The read Syscall waiting for Input did not run */
+        if(this->haltReason == HALT_INPUT) {
+            break;
+        }
+
+        blockLength++;
+
+        if(instructionPurpose == INSTRUCTION_ADDRESS || (this->breakpointCount && this->isBreakpoint(this->PC))) {
+            break;
+        }
     }
+
+    return blockLength;
+}
+
+/**
+ * Retrieves whether a Breakpoint is set inside a range of the Text Segment
+ *
+ * @param startAddress Address of the first Instruction of the range
+ * @param endAddress Address following the last Instruction of the range
+ * @return True if an Instruction of the range has a Breakpoint
+ */
+bool ExecutionScope::isBreakpointInRange(uint32_t startAddress, uint32_t endAddress) {
+    for(uint32_t address = startAddress; address < endAddress; address += 4) {
+        if(this->isBreakpoint(address)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Report the Breakpoint at the Program Counter - the Callback decides whether the Execution keeps running
+ *
+ * @return True if the Execution keeps running, False if it stops at the Breakpoint
+ */
+bool ExecutionScope::hitBreakpoint() {
+    bool keepRunning = false;
+
+    if(this->untilActive && this->PC == this->untilAddress) {
+        keepRunning = false;
+    } else if(this->breakpointCallback) {
+        this->flushOutput();
+        keepRunning = this->breakpointCallback(this, this->PC);
+    }
+
+    if(!keepRunning) {
+        this->halt(HALT_BREAKPOINT);
+    }
+
+    return keepRunning;
+}
+
+/**
+ * Report a watched access of the current Instruction - the Execution stops after the Instruction unless the Callback keeps it running
+ *
+ * @param address Guest Address of the access
+ * @param oldValue Value before the access
+ * @param newValue Value after the access
+ */
+void ExecutionScope::hitWatchpoint(uint32_t address, uint32_t oldValue, uint32_t newValue) {
+    bool keepRunning = false;
+
+    if(this->watchpointCallback) {
+        this->flushOutput();
+        keepRunning = this->watchpointCallback(this, this->PC, address, oldValue, newValue);
+    }
+
+    if(!keepRunning && this->haltReason == NOT_HALTED) {
+        this->halt(HALT_WATCHPOINT);
+    }
+}
+
+/**
+ * Add a Breakpoint at an Address of the Text Segment
+ *
+ * @param address Address of the Instruction
+ * @return True if the Breakpoint was added, False if the Address is not an Instruction of the Text Segment
+ */
+bool ExecutionScope::addBreakpoint(uint32_t address) {
+    if(address < this->textStart || address >= this->textEnd || address % 4 != 0) {
+        return false;
+    }
+
+    uint32_t wordIndex = (address - this->textStart) >> 2;
+    uint64_t wordMask = 1ull << (wordIndex & 63);
+
+    if(!(this->breakpointBitmap[wordIndex >> 6] & wordMask)) {
+        this->breakpointBitmap[wordIndex >> 6] |= wordMask;
+        this->breakpointCount++;
+    }
+
+    return true;
+}
+
+/**
+ * Add a Breakpoint at the first Instruction following a Label
+ *
+ * @param label Label Name
+ * @return True if the Breakpoint was added, False if the Label does not exist
+ */
+bool ExecutionScope::addBreakpoint(const std::string& label) {
+    std::string labelAddress = this->getLabelAddress(label);
+
+    /* Labels occupy a NOP Word: Branches land on the Instruction following it */
+    return labelAddress != "" && this->addBreakpoint(toUnsigned(labelAddress) + 4);
+}
+
+/**
+ * Remove the Breakpoint at an Address of the Text Segment
+ *
+ * @param address Address of the Instruction
+ * @return True if the Breakpoint was removed, False if there was no Breakpoint at the Address
+ */
+bool ExecutionScope::removeBreakpoint(uint32_t address) {
+    if(!this->isBreakpoint(address)) {
+        return false;
+    }
+
+    uint32_t wordIndex = (address - this->textStart) >> 2;
+
+    this->breakpointBitmap[wordIndex >> 6] &= ~(1ull << (wordIndex & 63));
+    this->breakpointCount--;
+
+    return true;
+}
+
+/**
+ * Remove the Breakpoint at the first Instruction following a Label
+ *
+ * @param label Label Name
+ * @return True if the Breakpoint was removed, False if there was no Breakpoint at the Label
+ */
+bool ExecutionScope::removeBreakpoint(const std::string& label) {
+    std::string labelAddress = this->getLabelAddress(label);
+
+    /* Labels occupy a NOP Word: Branches land on the Instruction following it */
+    return labelAddress != "" && this->removeBreakpoint(toUnsigned(labelAddress) + 4);
+}
+
+/**
+ * Set the Function called when a Breakpoint is hit (without a Callback the Execution stops at every Breakpoint)
+ *
+ * @param breakpointCallback Function called with the Execution Scope and the Address of the Breakpoint
+ */
+void ExecutionScope::setBreakpointCallback(BreakpointCallback breakpointCallback) {
+    this->breakpointCallback = breakpointCallback;
+}
+
+/**
+ * Watch a range of the Guest Memory - only the Pages of the range leave the TLB fast path
+ *
+ * @param address Guest Address of the first watched Byte
+ * @param size Number of watched Bytes
+ * @param watchType Accesses that trigger the Watchpoint (WATCH_READ, WATCH_WRITE or WATCH_ACCESS)
+ */
+void ExecutionScope::addWatchpoint(uint32_t address, uint32_t size, int watchType) {
+    this->memory.addWatchpoint(address, size, watchType);
+    this->watchpointCount++;
+}
+
+/**
+ * Remove a Watchpoint of the Guest Memory
+ *
+ * @param address Guest Address of the first watched Byte
+ * @param size Number of watched Bytes
+ * @param watchType Accesses that trigger the Watchpoint (WATCH_READ, WATCH_WRITE or WATCH_ACCESS)
+ * @return True if the Watchpoint was removed, False if there was no such Watchpoint
+ */
+bool ExecutionScope::removeWatchpoint(uint32_t address, uint32_t size, int watchType) {
+    if(!this->memory.removeWatchpoint(address, size, watchType)) {
+        return false;
+    }
+
+    this->watchpointCount--;
+
+    return true;
+}
+
+/**
+ * Set the Function called when a Watchpoint is hit (without a Callback the Execution stops after every watched access)
+ *
+ * @param watchpointCallback Function called with the Execution Scope, the Program Counter, the Address, the old and the new Value
+ */
+void ExecutionScope::setWatchpointCallback(WatchpointCallback watchpointCallback) {
+    this->watchpointCallback = watchpointCallback;
+}
+
+/**
+ * Set the Function the Guest Input is read from (without a Callback the Input is read from the Console)
+ *
+ * @param inputCallback Function called with the Execution Scope and the line to fill, returns False if no Input is available yet
+ */
+void ExecutionScope::setInputCallback(InputCallback inputCallback) {
+    this->inputCallback = inputCallback;
+}
+
+/**
+ * Set the Function the Guest Output is flushed to (without a Callback the Output is written to the Console)
+ *
+ * @param outputCallback Function called with the Execution Scope and the flushed Characters
+ */
+void ExecutionScope::setOutputCallback(OutputCallback outputCallback) {
+    this->outputCallback = outputCallback;
+}
+
+/**
+ * Execute the Syscall Service selected by $v0 (SPIM-compatible), the Arguments are taken from $a0 and $a1
+ */
+void ExecutionScope::executeSyscall() {
+    int syscallCode = static_cast<int>(toUnsigned(this->getRegisterValue("00010")));
+    uint32_t argument = toUnsigned(this->getRegisterValue("00100"));
+
+    if(syscallCode == SYSCALL_PRINT_INT) {
+        std::string intValue = std::to_string(static_cast<int32_t>(argument));
+        this->writeOutput(intValue.data(), intValue.size());
+    } else if(syscallCode == SYSCALL_PRINT_STRING) {
+        uint8_t charValue;
+
+        for(uint32_t address = argument; this->memory.readByte(address, charValue) && charValue != 0; address++) {
+            this->writeOutput(reinterpret_cast<const char*>(&charValue), 1);
+        }
+    } else if(syscallCode == SYSCALL_PRINT_CHAR) {
+        char charValue = static_cast<char>(argument & 0xFF);
+        this->writeOutput(&charValue, 1);
+    } else if(syscallCode == SYSCALL_READ_INT || syscallCode == SYSCALL_READ_CHAR || syscallCode == SYSCALL_READ_STRING) {
+        std::string inputValue;
+
+        if(!this->readInput(inputValue)) {
+            this->halt(HALT_INPUT);
+        } else if(syscallCode == SYSCALL_READ_INT) {
+            this->setRegisterValue("00010", toBinary(static_cast<int>(std::strtol(inputValue.c_str(), nullptr, 10))));
+        } else if(syscallCode == SYSCALL_READ_CHAR) {
+            this->setRegisterValue("00010", toBinary(inputValue.size() ? static_cast<uint8_t>(inputValue[0]) : '\n'));
+        } else {
+            uint32_t bufferLength = toUnsigned(this->getRegisterValue("00101"));
+            inputValue += "\n";
+
+            if(bufferLength > 0) {
+                uint32_t charIndex = 0;
+
+                for(; charIndex < bufferLength - 1 && charIndex < inputValue.size(); charIndex++) {
+                    this->memory.writeByte(argument + charIndex, static_cast<uint8_t>(inputValue[charIndex]));
+                }
+
+                this->memory.writeByte(argument + charIndex, 0);
+            }
+        }
+    } else if(syscallCode == SYSCALL_SBRK) {
+        std::string gpValue = this->getRegisterValue("11100");
+        uint32_t allocatedSize = (argument + 3) & ~3u;
+
+        this->setRegisterValue("00010", gpValue);
+        this->setRegisterValue("11100", toBinary(static_cast<int>(toUnsigned(gpValue) + allocatedSize)));
+    } else if(syscallCode == SYSCALL_EXIT || syscallCode == SYSCALL_EXIT2) {
+        this->exitCode = (syscallCode == SYSCALL_EXIT2) ? static_cast<int32_t>(argument) : 0;
+        this->halt(HALT_EXIT);
+    } else {
+        std::cout << "ERROR: Syscall " << syscallCode << " not supported!" << std::endl;
+    }
+}
+
+/**
+ * Write the buffered Guest Output to the Console, or to the Output Callback
+ */
+void ExecutionScope::flushOutput() {
+    if(this->outputBuffer.size() && this->outputCallback) {
+        this->outputCallback(this, this->outputBuffer.data(), this->outputBuffer.size());
+        this->outputBuffer.clear();
+    } else if(this->outputBuffer.size()) {
+        std::lock_guard<std::mutex> consoleGuard(consoleLock);
+
+        std::cout.write(this->outputBuffer.data(), this->outputBuffer.size());
+        std::cout.flush();
+
+        this->outputBuffer.clear();
+    }
+}
+
+/**
+ * Append Guest Output to the host-side Buffer, the Buffer is flushed when full
+ *
+ * @param data Characters written by the Guest
+ * @param size Number of Characters written by the Guest
+ */
+void ExecutionScope::writeOutput(const char* data, size_t size) {
+    if(this->outputBuffer.size() + size > outputBufferSize) {
+        this->flushOutput();
+    }
+
+    this->outputBuffer.append(data, size);
+}
+
+/**
+ * Read a line of Guest Input from the Console or the Input Callback, or from the Log while replaying (the pending Guest Output is flushed first)
+ *
+ * @param inputValue Line read without the trailing newline
+ * @return True if a line was read, False if the Input Callback has no Input yet
+ */
+bool ExecutionScope::readInput(std::string& inputValue) {
+    inputValue = "";
+
+    this->flushOutput();
+
+    if(this->replayLog != nullptr && this->replayLog->getMode() == LOG_REPLAY) {
+        if(!this->replayLog->replayInput(inputValue)) {
+            std::cout << "Replay diverged: no Input recorded!" << std::endl;
+        }
+
+        return true;
+    }
+
+    if(this->inputCallback) {
+        if(!this->inputCallback(this, inputValue)) {
+            return false;
+        }
+    } else {
+        std::lock_guard<std::mutex> consoleGuard(consoleLock);
+        std::getline(std::cin, inputValue);
+    }
+
+    if(this->replayLog != nullptr) {
+        this->replayLog->recordInput(inputValue);
+    }
+
+    return true;
 }
 
 /**
@@ -61,19 +724,24 @@ void ExecutionScope::executeScope() {
  * @param inputType Format used to print out the Instruction
  */
 void ExecutionScope::printInstructions(enum InputType inputType) {
+    if(inputType == INSTRUCTION_VALUE) {
+        Disassembler disassembler(this);
+        disassembler.disassemble(this->textStart, this->textEnd, std::cout);
+
+        return;
+    }
+
     std::string insAddress = startPC;
-    std::string insValue = "";
 
-    while((insValue = this->getWordValue(insAddress)) != "") {
-        if(inputType == INSTRUCTION_VALUE) {
-            Instruction* instructionScope = new Instruction(insValue, BINARY_VALUE, this);
-            instructionScope->setAddress(insAddress);
+    while(toUnsigned(insAddress) < this->textEnd) {
+        std::string insValue = this->getWordValue(insAddress);
 
-            std::cout << toHex(insAddress, 8) << ":    " << instructionScope->calculateInstruction() << std::endl;
-        } else if(inputType == BINARY_VALUE) {
-            std::cout << toHex(insAddress, 8) << ":    " << insValue << std::endl;
+        if(this->getLabelName(insAddress) != "") {
+            insValue = std::string(32, 'x');
         }
 
+        std::cout << toHex(insAddress, 8) << ":    " << insValue << std::endl;
+
         insAddress = addBinary(insAddress, "100");
     }
 }
@@ -86,6 +754,9 @@ void ExecutionScope::printRegisters() {
         std::string regPosition = std::bitset<5>(regIndex).to_string();
         std::cout << std::setw(5) << std::left << registerPointers[regIndex] << " (" << regPosition << "): " << this->getRegisterValue(regPosition) << std::endl;
     }
+
+    std::cout << std::setw(13) << std::left << "$hi" << ": " << std::bitset<32>(this->HI) << std::endl;
+    std::cout << std::setw(13) << std::left << "$lo" << ": " << std::bitset<32>(this->LO) << std::endl;
 }
 
 /**
@@ -101,16 +772,30 @@ void ExecutionScope::printMemory() {
     }
 }
 
+/**
+ * Print the Instruction Mix of the Execution, the pairs of Instructions run as Fused Operations and the Translated Blocks
+ */
+void ExecutionScope::printStatistics() {
+    this->statistics.printInstructionMix(this->memory, std::cout);
+
+    std::cout << "Fused pairs: lui+ori " << this->macroOpFusion.getPatternCount(FUSION_LOAD_CONSTANT)
+              << ", sll+addu " << this->macroOpFusion.getPatternCount(FUSION_SCALED_INDEX)
+              << ", slt+branch " << this->macroOpFusion.getPatternCount(FUSION_COMPARE_BRANCH)
+              << ", addi+branch " << this->macroOpFusion.getPatternCount(FUSION_COUNTED_LOOP)
+              << (this->fusionEnabled ? "" : " (disabled)") << std::endl;
+    std::cout << "Translated blocks: " << this->blockTranslator.getBlockCount() << " (" << this->blockTranslator.getInstructionCount() << " Instructions)"
+              << (this->translationEnabled ? "" : " (disabled)") << std::endl;
+}
+
 /**
  * Load Binary Values into the Dynamic Memory
  *
  * @param binaryValue Binary Values to be loaded into the Dynamic Memory
  */
-void ExecutionScope::loadValue(std::string binaryValue) {
-    std::string gpValue = this->getRegisterValue("11100");
-    this->setWordValue(gpValue, binaryValue);
+void ExecutionScope::loadValue(const std::string& binaryValue) {
+    uint32_t wordValue = toUnsigned(formatBinary(binaryValue, 32));
 
-    this->setRegisterValue("11100", addBinary(gpValue, "100"));
+    this->loadArray(&wordValue, 1);
 }
 
 /**
@@ -119,10 +804,9 @@ void ExecutionScope::loadValue(std::string binaryValue) {
  * @param decimalValue Integer that is converted into Binary Values and loaded into the Dynamic Memory
  */
 void ExecutionScope::loadValue(const int decimalValue) {
-    std::string gpValue = this->getRegisterValue("11100");
-    this->setWordValue(gpValue, toBinary(decimalValue));
+    uint32_t wordValue = static_cast<uint32_t>(decimalValue);
 
-    this->setRegisterValue("11100", addBinary(gpValue, "100"));
+    this->loadArray(&wordValue, 1);
 }
 
 /**
@@ -130,17 +814,15 @@ void ExecutionScope::loadValue(const int decimalValue) {
  *
  * @param arrayValue Array of Binary Values
  */
-void ExecutionScope::loadArray(std::vector<std::string> arrayValue) {
-    std::string gpValue = this->getRegisterValue("11100");
+void ExecutionScope::loadArray(const std::vector<std::string>& arrayValue) {
+    std::vector<uint32_t> wordValues;
+    wordValues.reserve(arrayValue.size());
 
-    for(unsigned int arrayIndex = 0; arrayIndex < arrayValue.size(); arrayIndex++) {
-        std::string value = formatBinary(arrayValue[arrayIndex], 32);
-        this->setWordValue(gpValue, value);
-
-        gpValue = addBinary(gpValue, "100");
+    for(const std::string& value : arrayValue) {
+        wordValues.push_back(toUnsigned(formatBinary(value, 32)));
     }
 
-    this->setRegisterValue("11100", gpValue);
+    this->loadArray(wordValues.data(), wordValues.size());
 }
 
 /**
@@ -148,17 +830,106 @@ void ExecutionScope::loadArray(std::vector<std::string> arrayValue) {
  *
  * @param arrayValue Array of Integer then converted into Binary Values
  */
-void ExecutionScope::loadArray(std::vector<int> arrayValue) {
-    std::string gpValue = this->getRegisterValue("11100");
+void ExecutionScope::loadArray(const std::vector<int>& arrayValue) {
+    this->loadArray(reinterpret_cast<const uint32_t*>(arrayValue.data()), arrayValue.size());
+}
 
-    for(unsigned int arrayIndex = 0; arrayIndex < arrayValue.size(); arrayIndex++) {
-        std::string value = std::bitset<32>(arrayValue[arrayIndex]).to_string();
-        this->setWordValue(gpValue, value);
+/**
+ * Load an array of Words into the Dynamic Memory - the Words are copied in bulk into the Guest Pages
+ * (ignored while replaying a Log: the Loads come from the Log)
+ *
+ * @param arrayValue First Word of the array
+ * @param arraySize Number of Words of the array
+ */
+void ExecutionScope::loadArray(const uint32_t* arrayValue, size_t arraySize) {
+    if(this->replayLog != nullptr) {
+        if(this->replayLog->getMode() == LOG_REPLAY) return;
 
-        gpValue = addBinary(gpValue, "100");
+        this->replayLog->recordWords(arrayValue, arraySize);
     }
 
-    this->setRegisterValue("11100", gpValue);
+    this->storeWords(arrayValue, arraySize);
+}
+
+/**
+ * Load an array of Bytes into the Dynamic Memory - the Global Pointer is then aligned to the next Word
+ * (ignored while replaying a Log: the Loads come from the Log)
+ *
+ * @param byteValues First Byte of the array
+ * @param byteCount Number of Bytes of the array
+ */
+void ExecutionScope::loadBytes(const uint8_t* byteValues, size_t byteCount) {
+    if(this->replayLog != nullptr) {
+        if(this->replayLog->getMode() == LOG_REPLAY) return;
+
+        this->replayLog->recordBytes(byteValues, byteCount);
+    }
+
+    this->storeBytes(byteValues, byteCount);
+}
+
+/**
+ * Load the same Word repeated into the Dynamic Memory (ignored while replaying a Log: the Loads come from the Log)
+ *
+ * @param wordValue Value of the Words
+ * @param wordCount Number of Words
+ */
+void ExecutionScope::fill(uint32_t wordValue, size_t wordCount) {
+    if(this->replayLog != nullptr) {
+        if(this->replayLog->getMode() == LOG_REPLAY) return;
+
+        this->replayLog->recordFill(wordValue, wordCount);
+    }
+
+    this->storeFill(wordValue, wordCount);
+}
+
+/**
+ * Store an array of Words at the Global Pointer, then move the Global Pointer after them
+ *
+ * @param arrayValue First Word of the array
+ * @param arraySize Number of Words of the array
+ */
+void ExecutionScope::storeWords(const uint32_t* arrayValue, size_t arraySize) {
+    uint32_t gpValue = toUnsigned(this->getRegisterValue("11100"));
+
+    if(!this->memory.writeWords(gpValue, arrayValue, arraySize)) {
+        std::cout << "Word not writable!" << std::endl;
+    }
+
+    this->setRegisterValue("11100", toBinary(gpValue + 4 * static_cast<uint32_t>(arraySize)));
+}
+
+/**
+ * Store an array of Bytes at the Global Pointer, then move the Global Pointer to the Word following them
+ *
+ * @param byteValues First Byte of the array
+ * @param byteCount Number of Bytes of the array
+ */
+void ExecutionScope::storeBytes(const uint8_t* byteValues, size_t byteCount) {
+    uint32_t gpValue = toUnsigned(this->getRegisterValue("11100"));
+
+    if(!this->memory.writeBytes(gpValue, byteValues, byteCount)) {
+        std::cout << "Byte not writable!" << std::endl;
+    }
+
+    this->setRegisterValue("11100", toBinary((gpValue + static_cast<uint32_t>(byteCount) + 3) & ~3u));
+}
+
+/**
+ * Store the same Word repeated at the Global Pointer, then move the Global Pointer after them
+ *
+ * @param wordValue Value of the Words
+ * @param wordCount Number of Words
+ */
+void ExecutionScope::storeFill(uint32_t wordValue, size_t wordCount) {
+    uint32_t gpValue = toUnsigned(this->getRegisterValue("11100"));
+
+    if(!this->memory.fillWords(gpValue, wordValue, wordCount)) {
+        std::cout << "Word not writable!" << std::endl;
+    }
+
+    this->setRegisterValue("11100", toBinary(gpValue + 4 * static_cast<uint32_t>(wordCount)));
 }
 
 /**
@@ -167,10 +938,18 @@ void ExecutionScope::loadArray(std::vector<int> arrayValue) {
  * @param regPosition Register selected to set the Value
  * @param value Value set to the specified Register
  */
-void ExecutionScope::setRegisterValue(std::string regPosition, std::string value) {
-    regPosition = formatBinary(regPosition, 5);
+void ExecutionScope::setRegisterValue(const std::string& regPosition, const std::string& value) {
+    this->listRegisters[formatBinary(regPosition, 5)] = formatBinary(value, 32);
+}
 
-    this->listRegisters[regPosition] = formatBinary(value, 32);
+/**
+ * Set the Word Value of a Register
+ *
+ * @param regIndex Number of the Register (0 - 31)
+ * @param value Value set to the Register
+ */
+void ExecutionScope::setRegisterWord(uint32_t regIndex, uint32_t value) {
+    this->listRegisters[registerPositions[regIndex & 31]] = toBinary(static_cast<int>(value));
 }
 
 /**
@@ -179,10 +958,14 @@ void ExecutionScope::setRegisterValue(std::string regPosition, std::string value
  * @param byteAddress Address used to select a certain Memory Location
  * @param byteValue Byte Value that is set at the Address specified
  */
-void ExecutionScope::setByteValue(std::string byteAddress, std::string byteValue) {
-    byteAddress = formatBinary(byteAddress, 32);
+void ExecutionScope::setByteValue(const std::string& byteAddress, const std::string& byteValue) {
+    uint32_t address = toUnsigned(formatBinary(byteAddress, 32));
 
-    this->memoryLocations[byteAddress] = formatBinary(byteValue, 8);
+    if(!this->memory.writeByte(address, toUnsigned(formatBinary(byteValue, 8)))) {
+        std::cout << "Byte not writable!" << std::endl;
+    } else if(address >= this->textStart && address < this->textEnd) {
+        this->blockTranslator.invalidate(address & ~3u);
+    }
 }
 
 /**
@@ -191,28 +974,71 @@ void ExecutionScope::setByteValue(std::string byteAddress, std::string byteValue
  * @param byteAddress, byteOffset Parameters used to calculate the Address used to set the Byte
  * @param byteValue Byte Value that is set at the Address calculated
  */
-void ExecutionScope::setByteValue(std::string byteAddress, std::string byteOffset, std::string byteValue) {
+void ExecutionScope::setByteValue(const std::string& byteAddress, const std::string& byteOffset, const std::string& byteValue) {
     std::string pointedAddress = addBinary(byteAddress, byteOffset);
 
     this->setByteValue(pointedAddress, byteValue);
 }
 
+/**
+ * Load a Word and reserve it (ll) - the next sc only stores if the Word still holds the loaded Value
+ *
+ * @param wordAddress, byteOffset Parameters used to calculate the Address of the Word
+ * @return the Word loaded ("" if the Word is not allocated, nothing is reserved if the Address is not aligned)
+ */
+std::string ExecutionScope::loadLinked(const std::string& wordAddress, const std::string& byteOffset) {
+    std::string pointedAddress = addBinary(wordAddress, byteOffset);
+    std::string wordValue = this->getWordValue(pointedAddress);
+
+    this->reservationAddress = toUnsigned(formatBinary(pointedAddress, 32));
+    this->isReserved = (this->reservationAddress % 4 == 0);
+    this->reservationValue = wordValue.size() ? toUnsigned(wordValue) : 0;
+
+    return wordValue;
+}
+
+/**
+ * Store a Word if the Reservation of the last ll still holds (sc) - the Word is compared and replaced atomically,
+ * so that only one of the Cores racing for the same reserved Word succeeds (the Reservation is cleared either way)
+ *
+ * @param wordAddress, byteOffset Parameters used to calculate the Address of the Word
+ * @param wordValue Word Value stored at the Address calculated
+ * @return True if the Word was stored, False if the Reservation was lost
+ */
+bool ExecutionScope::storeConditional(const std::string& wordAddress, const std::string& byteOffset, const std::string& wordValue) {
+    uint32_t address = toUnsigned(formatBinary(addBinary(wordAddress, byteOffset), 32));
+    bool isReserved = this->isReserved && this->reservationAddress == address;
+
+    this->isReserved = false;
+
+    if(!isReserved || !this->memory.compareExchangeWord(address, this->reservationValue, toUnsigned(formatBinary(wordValue, 32)))) {
+        return false;
+    }
+
+    if(address >= this->textStart && address < this->textEnd) {
+        this->blockTranslator.invalidate(address);
+    }
+
+    return true;
+}
+
+/**
+ * Share the Guest Memory of another Execution Scope - both then run on the same Pages (the Memory of this Execution Scope is dropped)
+ *
+ * @param sourceScope Execution Scope whose Memory is shared
+ */
+void ExecutionScope::shareMemory(ExecutionScope* sourceScope) {
+    this->memory.share(sourceScope->memory);
+}
+
 /**
  * Set the Value to a certain Word Memory Location specified by the Address
  *
  * @param wordAddress Address used to select a certain Memory Location
  * @param wordValue Word Value that is set at the Address specified
  */
-void ExecutionScope::setWordValue(std::string wordAddress, std::string wordValue) {
-    if(toDecimal(wordAddress) % 4 == 0) {
-        wordAddress = formatBinary(wordAddress, 32);
-        wordValue = formatBinary(wordValue, 32);
-
-        this->setByteValue(wordAddress, wordValue.substr(0, 8));
-        this->setByteValue(addBinary(wordAddress, "01"), wordValue.substr(8, 8));
-        this->setByteValue(addBinary(wordAddress, "10"), wordValue.substr(16, 8));
-        this->setByteValue(addBinary(wordAddress, "11"), wordValue.substr(24, 8));
-    }
+void ExecutionScope::setWordValue(const std::string& wordAddress, const std::string& wordValue) {
+    this->checkedWriteWord(toUnsigned(formatBinary(wordAddress, 32)), toUnsigned(formatBinary(wordValue, 32)));
 }
 
 /**
@@ -221,12 +1047,35 @@ void ExecutionScope::setWordValue(std::string wordAddress, std::string wordValue
  * @param wordAddress, byteOffset Parameters used to calculate the Address used to set the Word
  * @param wordValue Word Value that is set at the Address calculated
  */
-void ExecutionScope::setWordValue(std::string wordAddress, std::string byteOffset, std::string wordValue) {
+void ExecutionScope::setWordValue(const std::string& wordAddress, const std::string& byteOffset, const std::string& wordValue) {
     std::string pointedAddress = addBinary(wordAddress, byteOffset);
 
-    if(toDecimal(pointedAddress) % 4 == 0) {
-        this->setWordValue(pointedAddress, wordValue);
+    this->setWordValue(pointedAddress, wordValue);
+}
+
+/**
+ * Write a Word with the checks of the Stores (shared by the Interpreter and the Translators) - unaligned Addresses are ignored,
+ * a Store to the Text Segment drops the Translations holding the Word
+ *
+ * @param address Address of the Word
+ * @param wordValue Value of the Word
+ * @return True if the Word was written, otherwise return False
+ */
+bool ExecutionScope::checkedWriteWord(uint32_t address, uint32_t wordValue) {
+    if(address % 4 != 0) {
+        return false;
+    }
+
+    if(!this->memory.writeWord(address, wordValue)) {
+        std::cout << "Word not writable!" << std::endl;
+        return false;
+    }
+
+    if(address >= this->textStart && address < this->textEnd) {
+        this->blockTranslator.invalidate(address);
     }
+
+    return true;
 }
 
 /**
@@ -235,11 +1084,17 @@ void ExecutionScope::setWordValue(std::string wordAddress, std::string byteOffse
  * @param label Label Name
  * @param insAddress Address to be matched with the Label Name
  */
-void ExecutionScope::setLabelAddress(std::string label, std::string insAddress) {
-    insAddress = formatBinary(insAddress, 32);
+void ExecutionScope::setLabelAddress(const std::string& label, const std::string& insAddress) {
+    this->symbolTable.addSymbol(label, toUnsigned(insAddress));
+}
 
-    this->listLabels[label] = insAddress;
-    this->pointerLabels[insAddress] = label;
+/**
+ * Set the maximum number of Instructions executed by a run of the Execution Scope
+ *
+ * @param maxInstructions Maximum number of Instructions (0 = unlimited)
+ */
+void ExecutionScope::setInstructionBudget(uint64_t maxInstructions) {
+    this->instructionBudget = maxInstructions;
 }
 
 /**
@@ -247,8 +1102,17 @@ void ExecutionScope::setLabelAddress(std::string label, std::string insAddress)
  *
  * @param newPC The new Program Counter
  */
-void ExecutionScope::setPC(std::string newPC) {
-    this->PC = formatBinary(newPC, 32);
+void ExecutionScope::setPC(const std::string& newPC) {
+    this->PC = toUnsigned(formatBinary(newPC, 32));
+}
+
+/**
+ * Set the new Program Counter from its Address
+ *
+ * @param newPC Address of the new Program Counter
+ */
+void ExecutionScope::setPC(uint32_t newPC) {
+    this->PC = newPC;
 }
 
 /**
@@ -257,16 +1121,15 @@ void ExecutionScope::setPC(std::string newPC) {
  * @param addressingValue The value used to calculate the new Program Counter
  * @param addressingType The Type of Addressing used
  */
-void ExecutionScope::setPC(std::string addressingValue, enum AddressingType addressingType) {
+void ExecutionScope::setPC(const std::string& addressingValue, enum AddressingType addressingType) {
     if(addressingType == PC_RELATIVE_ADDRESSING) {
         /* PC = PC + 4 + BranchAddr */
-        std::string newPC = addBinary(this->PC, "100");
-        this->PC = addBinary(newPC, BranchAddr(addressingValue));
+        this->PC = this->PC + 4 + toUnsigned(BranchAddr(addressingValue));
     } else if(addressingType == PSEUDO_DIRECT_ADDRESSING) {
         /* PC = JumpAddr */
-        this->PC = JumpAddr(this->PC, addressingValue);
+        this->PC = toUnsigned(JumpAddr(this->getPC(), addressingValue));
     } else if(addressingType == REGISTER_ADDRESSING) {
-        this->PC = formatBinary(addressingValue, 32);
+        this->PC = toUnsigned(formatBinary(addressingValue, 32));
     }
 }
 
@@ -276,14 +1139,14 @@ void ExecutionScope::setPC(std::string addressingValue, enum AddressingType addr
  * @param byteAddress Address used to retrieve the Byte
  * @return the Byte allocated at the Address gave as parameter
  */
-std::string ExecutionScope::getByteValue(std::string byteAddress) {
-    byteAddress = formatBinary(byteAddress, 32);
+std::string ExecutionScope::getByteValue(const std::string& byteAddress) {
+    std::string address = formatBinary(byteAddress, 32);
 
-    if(this->isAllocated(byteAddress)) {
-        auto posLocation = memoryLocations.find(byteAddress);
+    if(this->isAllocated(address)) {
+        uint8_t byteValue;
 
-        if(posLocation != memoryLocations.end()) {
-            return formatBinary(posLocation->second, 8);
+        if(this->memory.readByte(toUnsigned(address), byteValue)) {
+            return std::bitset<8>(byteValue).to_string();
         }
     } else {
         std::cout << "Byte not allocated!" << std::endl;
@@ -298,7 +1161,7 @@ std::string ExecutionScope::getByteValue(std::string byteAddress) {
  * @param byteAddress, byteOffset Parameters used to calculate the Address used to retrieve the Byte
  * @return the Byte allocated at the Address calculated
  */
-std::string ExecutionScope::getByteValue(std::string byteAddress, std::string byteOffset) {
+std::string ExecutionScope::getByteValue(const std::string& byteAddress, const std::string& byteOffset) {
     std::string pointedAddress = addBinary(byteAddress, byteOffset);
 
     return this->getByteValue(pointedAddress);
@@ -310,18 +1173,11 @@ std::string ExecutionScope::getByteValue(std::string byteAddress, std::string by
  * @param wordAddress Address used to retrieve the Word
  * @return the Word allocated at the Address gave as parameter
  */
-std::string ExecutionScope::getWordValue(std::string wordAddress) {
-    if(toDecimal(wordAddress) % 4 == 0) {
-        if(this->isAllocated(wordAddress)) {
-            std::string firstByte = this->getByteValue(wordAddress);
-            std::string secondByte = this->getByteValue(addBinary(wordAddress, "01"));
-            std::string thirdByte = this->getByteValue(addBinary(wordAddress, "10"));
-            std::string fourthByte = this->getByteValue(addBinary(wordAddress, "11"));
+std::string ExecutionScope::getWordValue(const std::string& wordAddress) {
+    uint32_t wordValue;
 
-            return firstByte + secondByte + thirdByte + fourthByte;
-        } else {
-            std::cout << "Word not allocated!" << std::endl;
-        }
+    if(this->checkedReadWord(toUnsigned(formatBinary(wordAddress, 32)), this->getRegisterWord(29), this->getRegisterWord(28), wordValue)) {
+        return toBinary(wordValue);
     }
 
     return "";
@@ -333,14 +1189,34 @@ std::string ExecutionScope::getWordValue(std::string wordAddress) {
  * @param wordAddress, byteOffset Parameters used to calculate the Address used to retrieve the Word
  * @return the Word allocated at the Address calculated
  */
-std::string ExecutionScope::getWordValue(std::string wordAddress, std::string byteOffset) {
+std::string ExecutionScope::getWordValue(const std::string& wordAddress, const std::string& byteOffset) {
     std::string pointedAddress = addBinary(wordAddress, byteOffset);
 
-    if(toDecimal(pointedAddress) % 4 == 0) {
-        return this->getWordValue(pointedAddress);
-    } else {
-        return "";
+    return this->getWordValue(pointedAddress);
+}
+
+/**
+ * Read a Word with the checks of the Loads (shared by the Interpreter and the Translators) - unaligned Addresses read 0,
+ * the Addresses outside the Stack and the Data read 0 with a warning
+ *
+ * @param address Address of the Word
+ * @param stackValue, globalValue Values of $sp and $gp (the Translated Blocks hold them in their own Registers)
+ * @param wordValue Value of the Word read (0 if the Word cannot be read)
+ * @return True if the Word was read, otherwise return False
+ */
+bool ExecutionScope::checkedReadWord(uint32_t address, uint32_t stackValue, uint32_t globalValue, uint32_t& wordValue) {
+    wordValue = 0;
+
+    if(address % 4 != 0) {
+        return false;
+    }
+
+    if(!this->isAllocated(address, stackValue, globalValue)) {
+        std::cout << "Word not allocated!" << std::endl;
+        return false;
     }
+
+    return this->memory.readWord(address, wordValue);
 }
 
 /**
@@ -349,28 +1225,40 @@ std::string ExecutionScope::getWordValue(std::string wordAddress, std::string by
  * @param regPosition Register selected to get its Value
  * @return The Value assigned to the specified Register
  */
-std::string ExecutionScope::getRegisterValue(std::string regPosition) {
-    regPosition = formatBinary(regPosition, 5);
-    auto posRegister = listRegisters.find(regPosition);
+const std::string& ExecutionScope::getRegisterValue(const std::string& regPosition) {
+    static const std::string emptyValue = "";
+    auto posRegister = (regPosition.size() == 5) ? listRegisters.find(regPosition) : listRegisters.find(formatBinary(regPosition, 5));
 
     if(posRegister != listRegisters.end()) {
         return posRegister->second;
     } else {
-        return "";
+        return emptyValue;
     }
 }
 
+/**
+ * Get the Word Value of a Register
+ *
+ * @param regIndex Number of the Register (0 - 31)
+ * @return The Value of the Register (0 if it was never set)
+ */
+uint32_t ExecutionScope::getRegisterWord(uint32_t regIndex) {
+    auto posRegister = this->listRegisters.find(registerPositions[regIndex & 31]);
+
+    return (posRegister != this->listRegisters.end()) ? toWord(posRegister->second) : 0;
+}
+
 /**
  * Get the Address matched with the specified Label Name
  *
  * @param label Label Name
  * @return The Address matched with the specified Label Name
  */
-std::string ExecutionScope::getLabelAddress(std::string label) {
-    auto posLabel = listLabels.find(label);
+std::string ExecutionScope::getLabelAddress(const std::string& label) {
+    uint32_t labelAddress;
 
-    if(posLabel != listLabels.end()) {
-        return posLabel->second;
+    if(this->symbolTable.findAddress(label, labelAddress)) {
+        return toBinary(labelAddress);
     } else {
         return "";
     }
@@ -382,47 +1270,178 @@ std::string ExecutionScope::getLabelAddress(std::string label) {
  * @param address Address of the Label Location
  * @return Name of the Label found at the Address
  */
-std::string ExecutionScope::getLabelName(std::string address) {
-    auto posLabel = pointerLabels.find(formatBinary(address, 32));
+std::string ExecutionScope::getLabelName(const std::string& address) {
+    const char* labelName = this->symbolTable.findName(toUnsigned(address));
 
-    if(posLabel != pointerLabels.end()) {
-        return posLabel->second;
+    if(labelName != nullptr) {
+        return labelName;
     } else {
         return "";
     }
 }
 
+/**
+ * Get the Symbol Table that holds the Labels of the Execution Scope
+ *
+ * @return Symbol Table of the Labels
+ */
+const SymbolTable& ExecutionScope::getSymbolTable() const {
+    return this->symbolTable;
+}
+
+/**
+ * Get the Guest Memory of the Execution Scope
+ *
+ * @return Guest Memory that holds the Instructions and the Data
+ */
+GuestMemory& ExecutionScope::getMemory() {
+    return this->memory;
+}
+
+/**
+ * Get the Address of the first loaded Instruction
+ *
+ * @return First Address of the Text Segment
+ */
+uint32_t ExecutionScope::getTextStart() {
+    return this->textStart;
+}
+
+/**
+ * Get the Address following the last loaded Instruction
+ *
+ * @return End Address of the Text Segment
+ */
+uint32_t ExecutionScope::getTextEnd() {
+    return this->textEnd;
+}
+
+/**
+ * Get the attached Sampling Profiler
+ *
+ * @return Profiler (nullptr if not profiling)
+ */
+GuestProfiler* ExecutionScope::getProfiler() {
+    return this->profiler;
+}
+
+/**
+ * Get the Instruction Mix of the Execution - per-Purpose and per-Opcode counts, Load / Store volume and Branches taken
+ *
+ * @return Instruction Mix since the Execution was (re)started
+ */
+InstructionMix ExecutionScope::getInstructionMix() {
+    return this->statistics.getInstructionMix(this->memory);
+}
+
 /**
  * Get the Program Counter's Value
  *
  * @return current Program Counter's Value
  */
 std::string ExecutionScope::getPC() {
-    return this->PC;
+    return std::bitset<32>(this->PC).to_string();
+}
+
+/**
+ * Get the High Word of the Multiply / Divide Unit
+ *
+ * @return Value of the HI Register
+ */
+uint32_t ExecutionScope::getHI() {
+    return this->HI;
+}
+
+/**
+ * Get the Low Word of the Multiply / Divide Unit
+ *
+ * @return Value of the LO Register
+ */
+uint32_t ExecutionScope::getLO() {
+    return this->LO;
+}
+
+/**
+ * Set the Registers of the Multiply / Divide Unit
+ *
+ * @param hiValue Value of the HI Register (high Word of the Product / Remainder)
+ * @param loValue Value of the LO Register (low Word of the Product / Quotient)
+ */
+void ExecutionScope::setHiLo(uint32_t hiValue, uint32_t loValue) {
+    this->HI = hiValue;
+    this->LO = loValue;
 }
 
 /**
  * Increment the Program Counter to point to the next Instruction
  */
 void ExecutionScope::incPC() {
-    std::string newPC = addBinary(this->PC, "100");
+    this->PC += 4;
+}
 
-    this->PC = formatBinary(newPC, 32);
+/**
+ * Stop the Execution, the Execution Scope keeps its State
+ *
+ * @param haltReason Reason why the Execution stops
+ */
+void ExecutionScope::halt(enum HaltReason haltReason) {
+    this->haltReason = haltReason;
+
+    if(haltReason == HALT_EXIT) {
+        this->flushOutput();
+    }
 }
 
 /**
  * Retrieves if there are Instructions left to be executed
  *
- * @return True if there are Instructions left to be executed / False if all the Instructions were already executed
+ * @return True if the Execution halted / False if there are Instructions left to be executed
  */
 bool ExecutionScope::isFinished() {
-    if(toDecimal(this->PC) < toDecimal("10000000000000000000000000000")) {
-        auto posInstruction = memoryLocations.find(this->PC);
+    return this->haltReason != NOT_HALTED;
+}
+
+/**
+ * Get the Reason why the Execution halted
+ *
+ * @return Reason why the Execution halted (NOT_HALTED while running)
+ */
+enum HaltReason ExecutionScope::getHaltReason() {
+    return this->haltReason;
+}
+
+/**
+ * Get the Number of Instructions executed by the last run
+ *
+ * @return Number of Instructions executed
+ */
+uint64_t ExecutionScope::getInstructionCount() {
+    return this->instructionCount;
+}
 
-        return posInstruction == memoryLocations.end();
+/**
+ * Get the Exit Code passed by the Guest to the Exit Syscall
+ *
+ * @return Exit Code of the Guest (0 if the Guest did not use SYSCALL_EXIT2)
+ */
+int ExecutionScope::getExitCode() {
+    return this->exitCode;
+}
+
+/**
+ * Retrieves whether there is a Breakpoint at the Address
+ *
+ * @param address Address of the Instruction
+ * @return True if there is a Breakpoint at the Address, otherwise return False
+ */
+bool ExecutionScope::isBreakpoint(uint32_t address) {
+    if(address < this->textStart || address >= this->textEnd) {
+        return false;
     }
 
-    return true;
+    uint32_t wordIndex = (address - this->textStart) >> 2;
+
+    return (this->breakpointBitmap[wordIndex >> 6] >> (wordIndex & 63)) & 1;
 }
 
 /**
@@ -431,12 +1450,21 @@ bool ExecutionScope::isFinished() {
  * @param address Address Value where to check
  * @return True if the Memory Location is allocated, otherwise return False
  */
-bool ExecutionScope::isAllocated(std::string address) {
-    int addressDecimal = toDecimal(address);
+bool ExecutionScope::isAllocated(const std::string& address) {
+    return this->isAllocated(toUnsigned(formatBinary(address, 32)), this->getRegisterWord(29), this->getRegisterWord(28));
+}
+
+/**
+ * Check if the Address is allocated for given Values of $sp and $gp (the Translated Blocks hold them in their own Registers)
+ *
+ * @param address Address to check
+ * @param stackValue, globalValue Values of $sp and $gp
+ * @return True if the Address is in the Stack or in the Text and Data, otherwise return False
+ */
+bool ExecutionScope::isAllocated(uint32_t address, uint32_t stackValue, uint32_t globalValue) {
+    int32_t signedAddress = static_cast<int32_t>(address);
 
     //between SP and startSP | between startPC and GP
-    return ((addressDecimal >= toDecimal(getRegisterValue("11101")) &&
-             addressDecimal <  toDecimal(startSP)) ||
-            (addressDecimal >= toDecimal(startPC) &&
-             addressDecimal <= toDecimal(getRegisterValue("11100"))));
+    return (signedAddress >= static_cast<int32_t>(stackValue) && signedAddress < stackTop) ||
+           (signedAddress >= textBase && signedAddress <= static_cast<int32_t>(globalValue));
 }
@@ -0,0 +1,142 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Names of the Instruction Purposes, indexed by InstructionPurpose
+ */
+static const char* const purposeNames[4] = { "Maths", "Logic", "Address", "Move" };
+
+/**
+ * Static properties of an executed Word
+ */
+struct DecodedWord {
+    std::string name;                           ///< Mnemonic of the Instruction ("" if the Word is not a valid Instruction)
+    enum InstructionPurpose instructionPurpose; ///< Purpose of the Instruction
+    uint32_t loadBytes;                         ///< Bytes read by the Instruction
+    uint32_t storeBytes;                        ///< Bytes written by the Instruction
+    bool isBranch;                              ///< True if the Instruction is a conditional Branch
+};
+
+/**
+ * Decode the static properties of a Word through the Instruction Set
+ *
+ * @param insValue Value of the Word
+ * @return Static properties of the Word
+ */
+static DecodedWord decodeWord(uint32_t insValue) {
+    const InstructionInfo& instructionInfo = decodeInstruction(insValue);
+    enum InstructionKind instructionKind = instructionInfo.instructionKind;
+
+    DecodedWord decodedWord = { instructionInfo.mnemonic, instructionInfo.instructionPurpose, 0, 0, instructionKind == KIND_BRANCH };
+
+    if(instructionKind == KIND_LOAD || instructionKind == KIND_LOAD_LINKED) {
+        decodedWord.loadBytes = instructionInfo.accessBytes;
+    } else if(instructionKind == KIND_STORE || instructionKind == KIND_STORE_CONDITIONAL) {
+        decodedWord.storeBytes = instructionInfo.accessBytes;
+    }
+
+    return decodedWord;
+}
+
+/**
+ * Clear every Counter
+ */
+void ExecutionStatistics::reset() {
+    this->blockStatistics.clear();
+    this->lastBlockKey = 0;
+    this->lastBlock = nullptr;
+}
+
+/**
+ * Build the Instruction Mix - every counted Block is decoded once and weighted by its execution count
+ * (the Text Segment is read as it is now: the Instructions are assumed not to be modified while running)
+ *
+ * @param memory Guest Memory holding the executed Instructions
+ * @return Instruction Mix of the counted Blocks
+ */
+InstructionMix ExecutionStatistics::getInstructionMix(GuestMemory& memory) const {
+    InstructionMix instructionMix{};
+
+    std::unordered_map<uint32_t, DecodedWord> decodedWords;
+    std::vector<uint8_t> pageData(pageSize);
+    uint32_t cachedPage = 0;
+    bool isPageCached = false;
+
+    for(const auto& blockEntry : this->blockStatistics) {
+        uint32_t blockStart = static_cast<uint32_t>(blockEntry.first >> 32);
+        uint32_t blockLength = static_cast<uint32_t>(blockEntry.first);
+        const BlockStatistics& block = blockEntry.second;
+
+        instructionMix.blockCount += block.executionCount;
+        instructionMix.instructionCount += block.executionCount * blockLength;
+
+        for(uint32_t insIndex = 0; insIndex < blockLength; insIndex++) {
+            uint32_t insAddress = blockStart + 4 * insIndex;
+            auto posDecoded = decodedWords.find(insAddress);
+
+            if(posDecoded == decodedWords.end()) {
+                /* The Page is copied so that the Watchpoints are not triggered */
+                if(!isPageCached || cachedPage != (insAddress >> pageBits)) {
+                    cachedPage = insAddress >> pageBits;
+                    isPageCached = true;
+                    memory.copyPage(cachedPage, pageData.data());
+                }
+
+                uint32_t insValue = loadBigEndian(pageData.data() + (insAddress & (pageSize - 1)));
+                posDecoded = decodedWords.emplace(insAddress, decodeWord(insValue)).first;
+            }
+
+            const DecodedWord& decodedWord = posDecoded->second;
+
+            instructionMix.opcodeCounts[decodedWord.name] += block.executionCount;
+            instructionMix.purposeCounts[decodedWord.instructionPurpose] += block.executionCount;
+            instructionMix.loadBytes += block.executionCount * decodedWord.loadBytes;
+            instructionMix.storeBytes += block.executionCount * decodedWord.storeBytes;
+
+            /* A Branch can only end a Block: it is taken whenever the Execution did not fall through */
+            if(decodedWord.isBranch && insIndex == blockLength - 1) {
+                instructionMix.branchCount += block.executionCount;
+                instructionMix.takenCount += block.executionCount - block.fallthroughCount;
+            }
+        }
+    }
+
+    return instructionMix;
+}
+
+/**
+ * Print the Instruction Mix
+ *
+ * @param memory Guest Memory holding the executed Instructions
+ * @param output Stream the Instruction Mix is printed to
+ */
+void ExecutionStatistics::printInstructionMix(GuestMemory& memory, std::ostream& output) const {
+    InstructionMix instructionMix = this->getInstructionMix(memory);
+    double totalCount = instructionMix.instructionCount ? static_cast<double>(instructionMix.instructionCount) : 1.0;
+
+    std::ios_base::fmtflags outputFlags = output.flags();
+    output << std::fixed << std::setprecision(1);
+
+    output << "Instructions: " << instructionMix.instructionCount << " in " << instructionMix.blockCount << " Blocks" << std::endl;
+
+    for(int purposeIndex = 0; purposeIndex < 4; purposeIndex++) {
+        output << "  " << std::setw(10) << std::left << purposeNames[purposeIndex] << std::right << std::setw(12) << instructionMix.purposeCounts[purposeIndex]
+               << "  (" << 100.0 * instructionMix.purposeCounts[purposeIndex] / totalCount << "%)" << std::endl;
+    }
+
+    output << "Opcodes:" << std::endl;
+
+    for(const auto& opcodeEntry : instructionMix.opcodeCounts) {
+        output << "  " << std::setw(10) << std::left << (opcodeEntry.first.size() ? opcodeEntry.first : "(invalid)") << std::right << std::setw(12) << opcodeEntry.second
+               << "  (" << 100.0 * opcodeEntry.second / totalCount << "%)" << std::endl;
+    }
+
+    output << "Loads: " << instructionMix.loadBytes << " Bytes, Stores: " << instructionMix.storeBytes << " Bytes" << std::endl;
+    output << "Branches: " << instructionMix.branchCount << ", taken: " << instructionMix.takenCount;
+
+    if(instructionMix.branchCount) {
+        output << " (" << 100.0 * instructionMix.takenCount / instructionMix.branchCount << "%)";
+    }
+
+    output << std::endl;
+    output.flags(outputFlags);
+}
@@ -6,11 +6,10 @@
  * @param s Text that has to be evaluated
  * @return True if the String contains a Number / False if it does not
  */
-bool isNumber(std::string s) {
-    if(s.size() && (s[0] == '+' || s[0] == '-'))
-        s.erase(0, 1);
+bool isNumber(const std::string& s) {
+    size_t firstDigit = (s.size() && (s[0] == '+' || s[0] == '-')) ? 1 : 0;
 
-    for(unsigned int i = 0; i < s.length(); i++)
+    for(size_t i = firstDigit; i < s.length(); i++)
         if(std::isdigit(s[i]) == false)
             return false;
 
@@ -23,7 +22,7 @@ bool isNumber(std::string s) {
  * @param hexValue Text that has to be evaluated
  * @return True if the String contains an Hexadecimal Value / False if it does not
  */
-bool isHex(std::string hexValue) {
+bool isHex(const std::string& hexValue) {
     return hexValue.size() >= 2 && hexValue[0] == '0' && hexValue[1] == 'x';
 }
 
@@ -33,10 +32,37 @@ bool isHex(std::string hexValue) {
  * @param binaryValue Binary Value to be converted
  * @return Decimal Value of the Binary Value converted
  */
-int toDecimal(std::string binaryValue) {
+int toDecimal(const std::string& binaryValue) {
     return std::stoi(binaryValue, nullptr, 2);
 }
 
+/**
+ * Convert a Binary Value (up to 32 bits) into its Unsigned Value
+ *
+ * @param binaryValue Binary Value to be converted
+ * @return Unsigned Value of the Binary Value converted
+ */
+uint32_t toUnsigned(const std::string& binaryValue) {
+    return static_cast<uint32_t>(std::stoul(binaryValue, nullptr, 2));
+}
+
+/**
+ * Convert the rightmost 32 bits of a Binary Value into a Word (an empty Value is 0)
+ *
+ * @param binaryValue Binary Value to be converted
+ * @return Word Value of the Binary Value converted
+ */
+uint32_t toWord(const std::string& binaryValue) {
+    uint32_t wordValue = 0;
+    size_t firstBit = (binaryValue.size() > 32) ? binaryValue.size() - 32 : 0;
+
+    for(size_t bitIndex = firstBit; bitIndex < binaryValue.size(); bitIndex++) {
+        wordValue = (wordValue << 1) | (binaryValue[bitIndex] == '1');
+    }
+
+    return wordValue;
+}
+
 /**
  * Convert a String that can be a Binary or Hexadecimal Value into its Decimal Value
  *
@@ -44,18 +70,14 @@ int toDecimal(std::string binaryValue) {
  * @param inputFormat Format used for the value gave as input
  * @return Decimal Value of the Binary or Hexadecimal Value converted
  */
-int toDecimal(std::string inputValue, enum DataFormat inputFormat) {
+int toDecimal(const std::string& inputValue, enum DataFormat inputFormat) {
     if(inputFormat == BIN_FORMAT) {
         return toDecimal(inputValue);
     } else if(inputFormat == HEX_FORMAT) {
         int decimalValue;
         std::stringstream res;
 
-        if(isHex(inputValue)) {
-            inputValue.erase(0, 2);
-        }
-
-        res << std::hex << inputValue;
+        res << std::hex << (isHex(inputValue) ? inputValue.substr(2) : inputValue);
         res >> decimalValue;
 
         return decimalValue;
@@ -78,7 +100,7 @@ std::string toBinary(const int decimalValue) {
  * @param binaryValue Binary Value to be converted
  * @return Hexadecimal Value of the Binary Value converted
  */
-std::string toHex(std::string binaryValue) {
+std::string toHex(const std::string& binaryValue) {
     std::stringstream res;
     res << std::hex << std::uppercase << std::bitset<32>(binaryValue).to_ulong();
 
@@ -92,12 +114,45 @@ std::string toHex(std::string binaryValue) {
  * @param hexSize Size of the Hexadecimal Value to be returned
  * @return Hexadecimal Value of the Binary Value converted
  */
-std::string toHex(std::string binaryValue, const int hexSize) {
+std::string toHex(const std::string& binaryValue, const int hexSize) {
     std::string hexValue = toHex(binaryValue);
 
     return formatHex(hexValue, hexSize);
 }
 
+/**
+ * Name of a Halt Reason, as printed to the User
+ *
+ * @param haltReason Halt Reason to be named
+ * @return Name of the Halt Reason
+ */
+std::string haltReasonName(enum HaltReason haltReason) {
+    switch(haltReason) {
+        case NOT_HALTED:
+            return "Not Halted";
+        case HALT_EXIT:
+            return "Exit";
+        case HALT_BREAK:
+            return "Break";
+        case HALT_END_OF_TEXT:
+            return "End of Text";
+        case HALT_INSTRUCTION_BUDGET:
+            return "Instruction Budget";
+        case HALT_BREAKPOINT:
+            return "Breakpoint";
+        case HALT_STEP:
+            return "Step";
+        case HALT_WATCHPOINT:
+            return "Watchpoint";
+        case HALT_INVALID_INSTRUCTION:
+            return "Invalid Instruction";
+        case HALT_INPUT:
+            return "Input";
+    }
+
+    return "Unknown";
+}
+
 /**
  * Convert a Decimal Value into Two's Complement
  *
@@ -123,7 +178,7 @@ std::string toTwoComplement(const int decimalValue, const int binarySize) {
  * @param decimalValue Decimal Value to be converted
  * @return Binary Value that is the Two's Complement of the Decimal Value gave as argument
  */
-int fromTwoComplement(std::string binaryValue) {
+int fromTwoComplement(const std::string& binaryValue) {
     if(binaryValue[0] == '0') {
         return toDecimal(binaryValue);
     } else {
@@ -140,11 +195,11 @@ int fromTwoComplement(std::string binaryValue) {
  * @param binarySize Length of the Binary Value to be returned
  * @return The Binary Value transformed to have the Fixed Length specified by the Size parameter
  */
-std::string formatBinary(std::string binaryValue, const int binarySize) {
+std::string formatBinary(const std::string& binaryValue, const int binarySize) {
     if(binarySize > binaryValue.length()) {
         return std::string(binarySize - binaryValue.length(), '0') + binaryValue;
     } else if(binarySize < binaryValue.length()) {
-        return binaryValue.erase(0, binaryValue.length() - binarySize);
+        return binaryValue.substr(binaryValue.length() - binarySize);
     }
 
     return binaryValue;
@@ -157,18 +212,16 @@ std::string formatBinary(std::string binaryValue, const int binarySize) {
  * @param hexSize Length of the Hexadecimal Value to be returned
  * @return The Hexadecimal Value transformed to have the Fixed Length specified by the Size parameter
  */
-std::string formatHex(std::string hexValue, const int hexSize) {
-    if(isHex(hexValue)) {
-        hexValue.erase(0, 2);
-    }
+std::string formatHex(const std::string& hexValue, const int hexSize) {
+    std::string_view hexDigits = isHex(hexValue) ? std::string_view(hexValue).substr(2) : std::string_view(hexValue);
 
-    if(hexSize > hexValue.length()) {
-        return "0x" + std::string(hexSize - hexValue.length(), '0') + hexValue;
-    } else if(hexSize < hexValue.length()) {
-        return "0x" + hexValue.erase(0, hexValue.length() - hexSize);
+    if(hexSize > hexDigits.length()) {
+        return "0x" + std::string(hexSize - hexDigits.length(), '0') + std::string(hexDigits);
+    } else if(hexSize < hexDigits.length()) {
+        return "0x" + std::string(hexDigits.substr(hexDigits.length() - hexSize));
     }
 
-    return "0x" + hexValue;
+    return "0x" + std::string(hexDigits);
 }
 
 /**
@@ -177,7 +230,7 @@ std::string formatHex(std::string hexValue, const int hexSize) {
  * @param binaryValue Binary Value to be inverted
  * @return Result of the reverse of the Binary Value gave as argument
  */
-std::string invertBinary(std::string binaryValue) {
+std::string invertBinary(const std::string& binaryValue) {
     std::string binaryResult;
 
     for(int index = 0; index < binaryValue.size(); index++) {
@@ -196,24 +249,8 @@ std::string invertBinary(std::string binaryValue) {
  * @param binaryB Second Binary Value
  * @return Sum between the two Binary Values
  */
-std::string addBinary(std::string binaryA, std::string binaryB) {
-    std::string binaryResult;
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    int carry = 0;
-    for(int index = 31; index >= 0; index--) {
-        int a = binaryA[index] - 48;
-        int b = binaryB[index] - 48;
-
-        int sum = ((a ^ b) ^ carry);                    // sum = a xor b xor c
-        carry = ((a & b) | (a & carry)) | (b & carry);  // carry = ab + ac + bc
-
-        binaryResult.push_back(sum + 48);
-    }
-
-    std::reverse(binaryResult.begin(), binaryResult.end());
-    return binaryResult;
+std::string addBinary(const std::string& binaryA, const std::string& binaryB) {
+    return std::bitset<32>(toWord(binaryA) + toWord(binaryB)).to_string();
 }
 
 /**
@@ -223,52 +260,8 @@ std::string addBinary(std::string binaryA, std::string binaryB) {
  * @param binaryB Second Binary Value
  * @return Sum between the two Binary Values
  */
-std::string subBinary(std::string binaryA, std::string binaryB) {
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    std::string invertedB = invertBinary(binaryB);
-    binaryB = addBinary(invertedB, "1");
-
-    return addBinary(binaryA, binaryB);
-}
-
-/**
- * MULTIPLY two Binary Values
- *
- * @param binaryA First Binary Value
- * @param binaryB Second Binary Value
- * @return Multiplication between the two Binary Values
- */
-std::string mulBinary(std::string binaryA, std::string binaryB) {
-    std::string binaryResult = formatBinary("", 32);
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    for(int indexB = 31; indexB >= 0; indexB--) {
-        int b = binaryB[indexB] - 48;
-
-        if(b == 1) {
-            std::string binaryShifted = shiftLeftBinary(binaryA, toBinary(31 - indexB));
-            binaryResult = addBinary(binaryResult, binaryShifted);
-        }
-    }
-
-    return binaryResult;
-}
-
-/**
- * DIVIDE two Binary Values
- *
- * @param binaryA First Binary Value
- * @param binaryB Second Binary Value
- * @return Division between the two Binary Values
- */
-std::string divBinary(std::string binaryA, std::string binaryB) {
-    int decimalA = std::stoi(binaryA, nullptr, 2);
-    int decimalB = std::stoi(binaryB, nullptr, 2);
-
-    return std::bitset<32>((int)(decimalA / decimalB)).to_string();
+std::string subBinary(const std::string& binaryA, const std::string& binaryB) {
+    return std::bitset<32>(toWord(binaryA) - toWord(binaryB)).to_string();
 }
 
 /**
@@ -278,21 +271,8 @@ std::string divBinary(std::string binaryA, std::string binaryB) {
  * @param binaryB Second Binary Value
  * @return Result of the AND Logical Operation between the two Binary Values
  */
-std::string andBinary(std::string binaryA, std::string binaryB) {
-    std::string binaryResult;
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    for(int index = 0; index < 32; index++) {
-        int a = binaryA[index] - 48;
-        int b = binaryB[index] - 48;
-
-        int sum = a & b;
-
-        binaryResult.push_back(sum + 48);
-    }
-
-    return binaryResult;
+std::string andBinary(const std::string& binaryA, const std::string& binaryB) {
+    return std::bitset<32>(toWord(binaryA) & toWord(binaryB)).to_string();
 }
 
 /**
@@ -302,21 +282,8 @@ std::string andBinary(std::string binaryA, std::string binaryB) {
  * @param binaryB Second Binary Value
  * @return Result of the NOR Logical Operation between the two Binary Values
  */
-std::string norBinary(std::string binaryA, std::string binaryB) {
-    std::string binaryResult;
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    for(int index = 0; index < 32; index++) {
-        int a = binaryA[index] - 48;
-        int b = binaryB[index] - 48;
-
-        int sum = ~(a | b);
-
-        binaryResult.push_back(sum + 48);
-    }
-
-    return binaryResult;
+std::string norBinary(const std::string& binaryA, const std::string& binaryB) {
+    return std::bitset<32>(~(toWord(binaryA) | toWord(binaryB))).to_string();
 }
 
 /**
@@ -326,21 +293,8 @@ std::string norBinary(std::string binaryA, std::string binaryB) {
  * @param binaryB Second Binary Value
  * @return Result of the OR Logical Operation between the two Binary Values
  */
-std::string orBinary(std::string binaryA, std::string binaryB) {
-    std::string binaryResult;
-    binaryA = formatBinary(binaryA, 32);
-    binaryB = formatBinary(binaryB, 32);
-
-    for(int index = 0; index < 32; index++) {
-        int a = binaryA[index] - 48;
-        int b = binaryB[index] - 48;
-
-        int sum = a | b;
-
-        binaryResult.push_back(sum + 48);
-    }
-
-    return binaryResult;
+std::string orBinary(const std::string& binaryA, const std::string& binaryB) {
+    return std::bitset<32>(toWord(binaryA) | toWord(binaryB)).to_string();
 }
 
 /**
@@ -350,9 +304,9 @@ std::string orBinary(std::string binaryA, std::string binaryB) {
  * @param binaryShift Specifies the number of bit to shift the Binary Value to the Left
  * @return Result of the Shift Left Logical Operation on the Binary Value
  */
-std::string shiftLeftBinary(std::string binaryValue, std::string binaryShift) {
-    int decimalValue = std::stoi(binaryValue, nullptr, 2);
-    int decimalShift = std::stoi(binaryShift, nullptr, 2);
+std::string shiftLeftBinary(const std::string& binaryValue, const std::string& binaryShift) {
+    uint32_t decimalValue = toUnsigned(binaryValue);
+    uint32_t decimalShift = toUnsigned(binaryShift);
 
     return std::bitset<32>(decimalValue << decimalShift).to_string();
 }
@@ -364,9 +318,9 @@ std::string shiftLeftBinary(std::string binaryValue, std::string binaryShift) {
  * @param binaryShift Specifies the number of bit to shift the Binary Value to the Right
  * @return Result of the Shift Right Logical Operation on the Binary Value
  */
-std::string shiftRightBinary(std::string binaryValue, std::string binaryShift) {
-    int decimalValue = std::stoi(binaryValue, nullptr, 2);
-    int decimalShift = std::stoi(binaryShift, nullptr, 2);
+std::string shiftRightBinary(const std::string& binaryValue, const std::string& binaryShift) {
+    uint32_t decimalValue = toUnsigned(binaryValue);
+    uint32_t decimalShift = toUnsigned(binaryShift);
 
     return std::bitset<32>(decimalValue >> decimalShift).to_string();
 }
@@ -377,11 +331,11 @@ std::string shiftRightBinary(std::string binaryValue, std::string binaryShift) {
  * @param immediate Immediate Value gave as argument
  * @return Signed Extension of the Immediate Value
  */
-std::string SignExtImm(std::string immediate) {
-    immediate = formatBinary(immediate, 16);
-    char signExt = immediate[0];
+std::string SignExtImm(const std::string& immediate) {
+    std::string immValue = formatBinary(immediate, 16);
+    char signExt = immValue[0];
 
-    return std::string(16, signExt) + immediate;
+    return std::string(16, signExt) + immValue;
 }
 
 /**
@@ -390,10 +344,8 @@ std::string SignExtImm(std::string immediate) {
  * @param immediate Immediate Value gave as argument
  * @return Zero Extension of the Immediate Value
  */
-std::string ZeroExtImm(std::string immediate) {
-    immediate = formatBinary(immediate, 16);
-
-    return std::string(16, '0') + immediate;
+std::string ZeroExtImm(const std::string& immediate) {
+    return std::string(16, '0') + formatBinary(immediate, 16);
 }
 
 /**
@@ -402,11 +354,11 @@ std::string ZeroExtImm(std::string immediate) {
  * @param immediate Immediate Value gave as argument
  * @return Branch Address calculated from the Immediate Value
  */
-std::string BranchAddr(std::string immediate) {
-    immediate = formatBinary(immediate, 16);
-    char signExt = immediate[0];
+std::string BranchAddr(const std::string& immediate) {
+    std::string immValue = formatBinary(immediate, 16);
+    char signExt = immValue[0];
 
-    return std::string(14, signExt) + immediate + std::string(2, '0');
+    return std::string(14, signExt) + immValue + std::string(2, '0');
 }
 
 /**
@@ -416,143 +368,10 @@ std::string BranchAddr(std::string immediate) {
  * @param address Address Value gave as argument
  * @return Jump Address calculated from the Program Counter and the Address Value
  */
-std::string JumpAddr(std::string PC, std::string address) {
-    address = formatBinary(address, 26);
+std::string JumpAddr(const std::string& PC, const std::string& address) {
     std::string newPC = addBinary(PC, "100");
 
-    return newPC.substr(0, 4) + address + std::string(2, '0');
-}
-
-/**
- * ADD Instruction -> R[rd] = R[rs] + R[rt]
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void ADD_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = addBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * ADDI Instruction -> R[rt] = R[rs] + SignExtImm
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void ADDI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = SignExtImm(funcParams[2]);
-    std::string resultValue = addBinary(rsValue, immValue);
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * ADDIU Instruction -> R[rt] = R[rs] + SignExtImm
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void ADDIU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = SignExtImm(funcParams[2]);
-    std::string resultValue = addBinary(rsValue, immValue);
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * ADDU Instruction -> R[rd] = R[rs] + R[rt]
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void ADDU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = addBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * AND Instruction -> R[rd] = R[rs] & R[rt]
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void AND_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = andBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * ANDI Instruction -> R[rt] = R[rs] & ZeroExtImm
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void ANDI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = ZeroExtImm(funcParams[2]);
-    std::string resultValue = andBinary(rsValue, immValue);
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * BEQ Instruction -> if(R[rs] == R[rt]) { PC = PC + 4 + BranchAddr }
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rs, rt, imm)
- */
-void BEQ_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rsValue = executionScope->getRegisterValue(funcParams[0]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = funcParams[2];
-
-    if(rsValue.compare(rtValue) == 0) {
-        executionScope->setPC(immValue, PC_RELATIVE_ADDRESSING);
-    } else {
-        executionScope->incPC();
-    }
-}
-
-/**
- * BNE Instruction -> if(R[rs] != R[rt]) { PC = PC + 4 + BranchAddr }
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rs, rt, imm)
- */
-void BNE_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rsValue = executionScope->getRegisterValue(funcParams[0]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = funcParams[2];
-
-    if(rsValue.compare(rtValue) != 0) {
-        executionScope->setPC(immValue, PC_RELATIVE_ADDRESSING);
-    } else {
-        executionScope->incPC();
-    }
+    return newPC.substr(0, 4) + formatBinary(address, 26) + std::string(2, '0');
 }
 
 /**
@@ -561,8 +380,8 @@ void BNE_function(ExecutionScope* executionScope, std::vector<std::string> funcP
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (addr)
  */
-void J_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string addrValue = funcParams[0];
+void J_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    const std::string& addrValue = funcParams[0];
 
     executionScope->setPC(addrValue, PSEUDO_DIRECT_ADDRESSING);
 }
@@ -573,14 +392,18 @@ void J_function(ExecutionScope* executionScope, std::vector<std::string> funcPar
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (addr)
  */
-void JAL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string addrValue = funcParams[0];
+void JAL_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    const std::string& addrValue = funcParams[0];
 
     std::string PC = executionScope->getPC();
     std::string newPC = addBinary(PC, "100");
 
     executionScope->setRegisterValue("11111", newPC);
     executionScope->setPC(addrValue, PSEUDO_DIRECT_ADDRESSING);
+
+    if(executionScope->getProfiler() != nullptr) {
+        executionScope->getProfiler()->enterCall(toUnsigned(executionScope->getPC()), toUnsigned(newPC));
+    }
 }
 
 /**
@@ -589,46 +412,15 @@ void JAL_function(ExecutionScope* executionScope, std::vector<std::string> funcP
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (rs)
  */
-void JR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rsValue = executionScope->getRegisterValue(funcParams[0]);
+void JR_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    const std::string& rsValue = executionScope->getRegisterValue(funcParams[0]);
 
     executionScope->setPC(rsValue, REGISTER_ADDRESSING);
-}
-
-/**
- * LBU Instruction -> R[rt] = {24b0, M[R[rs] + SignExtImm](7:0)}
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, imm, rs)
- */
-void LBU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
-
-    std::string wordValue = executionScope->getWordValue(rsValue, immValue);
-    std::string resultValue = (wordValue.size()) ? wordValue.substr(24, 8) : "";
 
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * LHU Instruction -> R[rt] = {16b0, M[R[rs] + SignExtImm](15:0)}
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, imm, rs)
- */
-void LHU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
-
-    std::string wordValue = executionScope->getWordValue(rsValue, immValue);
-    std::string resultValue = (wordValue.size()) ? wordValue.substr(16, 16) : "";
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
+    /* Only jr $ra returns from a Call */
+    if(funcParams[0] == "11111" && executionScope->getProfiler() != nullptr) {
+        executionScope->getProfiler()->leaveCall(toUnsigned(executionScope->getPC()));
+    }
 }
 
 /**
@@ -637,9 +429,9 @@ void LHU_function(ExecutionScope* executionScope, std::vector<std::string> funcP
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (rt, imm)
  */
-void LUI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string immValue = funcParams[1];
+void LUI_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    const std::string& rtValue = funcParams[0];
+    const std::string& immValue = funcParams[1];
 
     std::string resultValue = formatBinary(immValue, 16) + formatBinary("", 16);
 
@@ -648,272 +440,87 @@ void LUI_function(ExecutionScope* executionScope, std::vector<std::string> funcP
 }
 
 /**
- * LW Instruction -> R[rt] = M[R[rs] + SignExtImm]
+ * LL Instruction -> R[rt] = M[R[rs] + SignExtImm], the Word is reserved
  *
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (rt, imm, rs)
  */
-void LW_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
+void LL_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
     std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
-
-    std::string resultValue = executionScope->getWordValue(rsValue, immValue);
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * NOR Instruction -> R[rd] = ~(R[rs] | R[rt])
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void NOR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = norBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * OR Instruction -> R[rd] = R[rs] | R[rt]
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void OR_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = orBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * ORI Instruction -> R[rt] = R[rs] | ZeroExtImm
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void ORI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = ZeroExtImm(funcParams[2]);
-    std::string resultValue = orBinary(rsValue, immValue);
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SLT Instruction -> R[rd] = (R[rs] < R[rt]) ? 1 : 0
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void SLT_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = (toDecimal(rsValue) < toDecimal(rtValue)) ? "1" : "0";
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SLTI Instruction -> R[rt] = (R[rs] < SignExtImm) ? 1 : 0
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void SLTI_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = SignExtImm(funcParams[2]);
-    std::string resultValue = (toDecimal(rsValue) < toDecimal(immValue)) ? "1" : "0";
-
-    executionScope->setRegisterValue(rtValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SLTIU Instruction -> R[rt] = (R[rs] < SignExtImm) ? 1 : 0
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, rs, imm)
- */
-void SLTIU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string immValue = SignExtImm(funcParams[2]);
-    std::string resultValue = (toDecimal(rsValue) < toDecimal(immValue)) ? "1" : "0";
+    const std::string& rsValue = executionScope->getRegisterValue(funcParams[2]);
 
-    executionScope->setRegisterValue(rtValue, resultValue);
+    executionScope->setRegisterValue(funcParams[0], executionScope->loadLinked(rsValue, immValue));
     executionScope->incPC();
 }
 
 /**
- * SLTU Instruction -> R[rd] = (R[rs] < R[rt]) ? 1 : 0
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
- */
-void SLTU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = (toDecimal(rsValue) < toDecimal(rtValue)) ? "1" : "0";
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SLL Instruction -> R[rd] = R[rt] << shamt
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rt, shamt)
- */
-void SLL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rtValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string shamtValue = funcParams[2];
-    std::string resultValue = shiftLeftBinary(rtValue, shamtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SRL Instruction -> R[rd] = R[rt] >> shamt
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rt, shamt)
- */
-void SRL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rtValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string shamtValue = funcParams[2];
-    std::string resultValue = shiftRightBinary(rtValue, shamtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
-}
-
-/**
- * SB Instruction -> M[R[rs] + SignExtImm](7:0) = R[rt](7:0)
+ * SC Instruction -> if(Reserved) { M[R[rs] + SignExtImm] = R[rt], R[rt] = 1 } else { R[rt] = 0 }
  *
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values (rt, imm, rs)
  */
-void SB_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
+void SC_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
     std::string rtValue = executionScope->getRegisterValue(funcParams[0]);
     std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
+    const std::string& rsValue = executionScope->getRegisterValue(funcParams[2]);
 
-    executionScope->setWordValue(rsValue, immValue, rtValue.substr(24, 8));
-    executionScope->incPC();
-}
+    bool isStored = executionScope->storeConditional(rsValue, immValue, rtValue);
 
-/**
- * SH Instruction -> M[R[rs] + SignExtImm](15:0) = R[rt](15:0)
- *
- * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, imm, rs)
- */
-void SH_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = executionScope->getRegisterValue(funcParams[0]);
-    std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
-
-    executionScope->setWordValue(rsValue, immValue, rtValue.substr(16, 16));
+    executionScope->setRegisterValue(funcParams[0], toBinary(isStored ? 1 : 0));
     executionScope->incPC();
 }
 
 /**
- * SW Instruction -> M[R[rs] + SignExtImm] = R[rt]
+ * SYNC Instruction -> full barrier (see the memory model of GuestMachine)
  *
  * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rt, imm, rs)
  */
-void SW_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rtValue = executionScope->getRegisterValue(funcParams[0]);
-    std::string immValue = SignExtImm(funcParams[1]);
-    std::string rsValue = executionScope->getRegisterValue(funcParams[2]);
-
-    executionScope->setWordValue(rsValue, immValue, rtValue);
+void SYNC_function(ExecutionScope* executionScope, const std::vector<std::string>&) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
     executionScope->incPC();
 }
 
 /**
- * SUB Instruction -> R[rd] = R[rs] - R[rt]
+ * MFHI Instruction -> R[rd] = HI
  *
  * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
+ * @param funcParams Parameters Values (rd)
  */
-void SUB_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = subBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
+void MFHI_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    executionScope->setRegisterValue(funcParams[0], toBinary(executionScope->getHI()));
     executionScope->incPC();
 }
 
 /**
- * SUBU Instruction -> R[rd] = R[rs] - R[rt]
+ * MFLO Instruction -> R[rd] = LO
  *
  * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
+ * @param funcParams Parameters Values (rd)
  */
-void SUBU_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = subBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
+void MFLO_function(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) {
+    executionScope->setRegisterValue(funcParams[0], toBinary(executionScope->getLO()));
     executionScope->incPC();
 }
 
 /**
- * MUL Instruction -> R[rd] = R[rs] * R[rt]
+ * SYSCALL Instruction -> Execute the Service selected by $v0
  *
  * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
  */
-void MUL_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = mulBinary(rsValue, rtValue);
+void SYSCALL_function(ExecutionScope* executionScope, const std::vector<std::string>&) {
+    executionScope->executeSyscall();
 
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
+    /* A read Syscall that found no Input keeps the Program Counter: it runs again once the Execution is resumed */
+    if(executionScope->getHaltReason() != HALT_INPUT) {
+        executionScope->incPC();
+    }
 }
 
 /**
- * DIV Instruction -> R[rd] = R[rs] / R[rt]
+ * BREAK Instruction -> Halt the Execution (the Program Counter keeps pointing to the Break)
  *
  * @param executionScope Execution Scope
- * @param funcParams Parameters Values (rd, rs, rt)
  */
-void DIV_function(ExecutionScope* executionScope, std::vector<std::string> funcParams) {
-    std::string rdValue = funcParams[0];
-    std::string rsValue = executionScope->getRegisterValue(funcParams[1]);
-    std::string rtValue = executionScope->getRegisterValue(funcParams[2]);
-    std::string resultValue = divBinary(rsValue, rtValue);
-
-    executionScope->setRegisterValue(rdValue, resultValue);
-    executionScope->incPC();
+void BREAK_function(ExecutionScope* executionScope, const std::vector<std::string>&) {
+    executionScope->halt(HALT_BREAK);
 }
-
@@ -0,0 +1,151 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * GuestEventLoop Constructor
+ *
+ * @param sliceLength Instructions a Guest runs before it goes back to the end of the Run Queue (at least 1)
+ */
+GuestEventLoop::GuestEventLoop(uint64_t sliceLength) : sliceLength(std::max<uint64_t>(sliceLength, 1)) {
+
+}
+
+/**
+ * Load a Program into a new Guest and put the Guest at the end of the Run Queue (Guests are added from the thread that runs the Loop)
+ *
+ * @param instructions List of Instructions to load into the Guest
+ * @param memoryBackend Backend used to store the Guest Memory (Guests share no Memory, each one can use Fast Memory)
+ * @return Index of the Guest
+ */
+uint32_t GuestEventLoop::addGuest(const std::vector<std::string>& instructions, enum MemoryBackend memoryBackend) {
+    uint32_t guestIndex = static_cast<uint32_t>(this->guests.size());
+    LoopGuest* loopGuest = new LoopGuest();
+
+    loopGuest->executionScope.reset(new ExecutionScope(instructions, memoryBackend));
+
+    loopGuest->executionScope->setInputCallback([this, loopGuest](ExecutionScope*, std::string& inputValue) {
+        return this->readInput(*loopGuest, inputValue);
+    });
+
+    loopGuest->executionScope->setOutputCallback([loopGuest](ExecutionScope*, const char* data, size_t size) {
+        loopGuest->output.append(data, size);
+    });
+
+    std::lock_guard<std::mutex> queueGuard(this->queueLock);
+
+    this->guests.emplace_back(loopGuest);
+    this->runQueue.push_back(guestIndex);
+
+    return guestIndex;
+}
+
+/**
+ * Provide a line of Input to a Guest - a Guest waiting for Input goes back to the end of the Run Queue (safe to call from any thread)
+ *
+ * @param guestIndex Index of the Guest
+ * @param inputLine Line read by the next read Syscall of the Guest (without the trailing newline)
+ */
+void GuestEventLoop::provideInput(uint32_t guestIndex, const std::string& inputLine) {
+    std::lock_guard<std::mutex> queueGuard(this->queueLock);
+    LoopGuest& loopGuest = *this->guests[guestIndex];
+
+    loopGuest.pendingInput.push_back(inputLine);
+
+    if(loopGuest.isWaiting) {
+        loopGuest.isWaiting = false;
+        this->runQueue.push_back(guestIndex);
+    }
+}
+
+/**
+ * Run the Guests of the Run Queue in turn, a Slice each, until the Queue is empty (every Guest halted or waits for Input)
+ */
+void GuestEventLoop::run() {
+    while(true) {
+        uint32_t guestIndex;
+
+        {
+            std::lock_guard<std::mutex> queueGuard(this->queueLock);
+
+            if(this->runQueue.empty()) {
+                return;
+            }
+
+            guestIndex = this->runQueue.front();
+            this->runQueue.pop_front();
+        }
+
+        LoopGuest& loopGuest = *this->guests[guestIndex];
+        loopGuest.executionScope->step(this->sliceLength);
+
+        enum HaltReason haltReason = loopGuest.executionScope->getHaltReason();
+        std::lock_guard<std::mutex> queueGuard(this->queueLock);
+
+        /* Input provided while the Slice ran wakes the Guest at once */
+        if(haltReason == HALT_STEP || (haltReason == HALT_INPUT && !loopGuest.pendingInput.empty())) {
+            this->runQueue.push_back(guestIndex);
+        } else if(haltReason == HALT_INPUT) {
+            loopGuest.isWaiting = true;
+        }
+    }
+}
+
+/**
+ * Get a Guest of the Loop
+ *
+ * @param guestIndex Index of the Guest
+ * @return Execution Scope of the Guest, nullptr if the Loop has no such Guest
+ */
+ExecutionScope* GuestEventLoop::getGuest(uint32_t guestIndex) {
+    return (guestIndex < this->guests.size()) ? this->guests[guestIndex]->executionScope.get() : nullptr;
+}
+
+/**
+ * Get the Output written by a Guest so far (read it while the Loop is not running)
+ *
+ * @param guestIndex Index of the Guest
+ * @return Output of the Guest
+ */
+const std::string& GuestEventLoop::getOutput(uint32_t guestIndex) {
+    return this->guests[guestIndex]->output;
+}
+
+/**
+ * Get the number of Guests of the Loop
+ *
+ * @return Number of Guests
+ */
+uint32_t GuestEventLoop::getGuestCount() const {
+    return static_cast<uint32_t>(this->guests.size());
+}
+
+/**
+ * Retrieves whether a Guest waits for Input
+ *
+ * @param guestIndex Index of the Guest
+ * @return True if the Guest is out of the Run Queue until Input is provided
+ */
+bool GuestEventLoop::isWaiting(uint32_t guestIndex) {
+    std::lock_guard<std::mutex> queueGuard(this->queueLock);
+
+    return this->guests[guestIndex]->isWaiting;
+}
+
+/**
+ * Read the next line of Input provided to a Guest (Input Callback of its Execution Scope)
+ *
+ * @param loopGuest Guest reading the Input
+ * @param inputValue Line read
+ * @return True if a line was read, False if the Guest has no Input yet (its read Syscall stops the Slice)
+ */
+bool GuestEventLoop::readInput(LoopGuest& loopGuest, std::string& inputValue) {
+    std::lock_guard<std::mutex> queueGuard(this->queueLock);
+
+    if(loopGuest.pendingInput.empty()) {
+        return false;
+    }
+
+    inputValue = loopGuest.pendingInput.front();
+    loopGuest.pendingInput.pop_front();
+
+    return true;
+}
@@ -0,0 +1,330 @@
+#include "../includes/mips_emulator.h"
+
+#include <condition_variable>
+#include <thread>
+
+/**
+ * GuestMachine Constructor - loads the Program once and gives every Core the same Pages
+ * (each Core starts at the first Instruction with $a0 = Core Index, $a1 = Core Count and its own Stack)
+ *
+ * @param instructions List of Instructions to load into the Guest Memory
+ * @param coreCount Number of Cores (at least 1)
+ */
+GuestMachine::GuestMachine(const std::vector<std::string>& instructions, uint32_t coreCount) {
+    coreCount = std::max<uint32_t>(coreCount, 1);
+
+    for(uint32_t coreIndex = 0; coreIndex < coreCount; coreIndex++) {
+        ExecutionScope* core = new ExecutionScope(instructions, PAGED_MEMORY);
+
+        if(coreIndex > 0) {
+            core->shareMemory(this->cores[0].get());
+        }
+
+        core->setRegisterWord(4, coreIndex);
+        core->setRegisterWord(5, coreCount);
+        core->setRegisterWord(29, toUnsigned(startSP) - coreIndex * coreStackSize);
+
+        this->cores.emplace_back(core);
+    }
+
+    this->publishedMemory.share(this->cores[0]->getMemory());
+}
+
+/**
+ * Run every Core from the first Instruction on its own host thread, until every Core halts
+ */
+void GuestMachine::run() {
+    this->startCores();
+
+    std::vector<std::thread> coreThreads;
+    coreThreads.reserve(this->cores.size());
+
+    for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+        ExecutionScope* coreScope = core.get();
+        coreThreads.emplace_back([coreScope]() { coreScope->executeScope(); });
+    }
+
+    for(std::thread& coreThread : coreThreads) {
+        coreThread.join();
+    }
+}
+
+/**
+ * Run every Core from the first Instruction in deterministic rounds, until every Core halts - in each round the Cores run
+ * a Quantum of Instructions in parallel on private views of the Memory, their writes are published in Core order at the barrier,
+ * then the Cores stopped at ll, sc, sync or syscall run a Quantum each in Core order
+ *
+ * @param quantum Instructions each Core runs per round
+ * @param workerCount Number of worker threads (0 = one per host CPU)
+ */
+void GuestMachine::runQuanta(uint64_t quantum, uint32_t workerCount) {
+    uint32_t coreCount = static_cast<uint32_t>(this->cores.size());
+
+    quantum = std::max<uint64_t>(quantum, 1);
+    workerCount = (workerCount == 0) ? std::thread::hardware_concurrency() : workerCount;
+    workerCount = std::min(std::max<uint32_t>(workerCount, 1), coreCount);
+
+    this->startCores();
+    this->isolateCores();
+
+    std::mutex roundLock;
+    std::condition_variable roundStarted;
+    std::condition_variable roundFinished;
+    uint64_t roundNumber = 0;
+    uint32_t busyWorkers = 0;
+    bool isStopping = false;
+    std::atomic<uint32_t> nextCore(0);
+
+    /* Each worker takes the Cores of the round one at a time, the Cores never touch each other's Registers or Memory */
+    auto runWorker = [&]() {
+        uint64_t workerRound = 0;
+
+        while(true) {
+            {
+                std::unique_lock<std::mutex> roundGuard(roundLock);
+                roundStarted.wait(roundGuard, [&]() { return isStopping || roundNumber != workerRound; });
+
+                if(isStopping) {
+                    return;
+                }
+
+                workerRound = roundNumber;
+            }
+
+            for(uint32_t coreIndex = nextCore++; coreIndex < coreCount; coreIndex = nextCore++) {
+                if(this->isRunnable(coreIndex) && !this->isSerializing(coreIndex)) {
+                    this->cores[coreIndex]->step(quantum);
+                }
+            }
+
+            std::lock_guard<std::mutex> roundGuard(roundLock);
+
+            if(--busyWorkers == 0) {
+                roundFinished.notify_one();
+            }
+        }
+    };
+
+    std::vector<std::thread> workerThreads;
+    workerThreads.reserve(workerCount);
+
+    for(uint32_t workerIndex = 0; workerIndex < workerCount; workerIndex++) {
+        workerThreads.emplace_back(runWorker);
+    }
+
+    bool isRunning = true;
+
+    while(isRunning) {
+        {
+            std::unique_lock<std::mutex> roundGuard(roundLock);
+
+            nextCore = 0;
+            busyWorkers = workerCount;
+            roundNumber++;
+            roundStarted.notify_all();
+
+            roundFinished.wait(roundGuard, [&]() { return busyWorkers == 0; });
+        }
+
+        this->publishWrites(0, coreCount);
+
+        this->isSerialPhase = true;
+
+        for(uint32_t coreIndex = 0; coreIndex < coreCount; coreIndex++) {
+            if(this->isRunnable(coreIndex) && this->isSerializing(coreIndex)) {
+                this->cores[coreIndex]->step(quantum);
+                this->publishWrites(coreIndex, coreIndex + 1);
+            }
+        }
+
+        this->isSerialPhase = false;
+
+        isRunning = false;
+
+        for(uint32_t coreIndex = 0; coreIndex < coreCount; coreIndex++) {
+            isRunning = isRunning || this->isRunnable(coreIndex);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> roundGuard(roundLock);
+        isStopping = true;
+        roundStarted.notify_all();
+    }
+
+    for(std::thread& workerThread : workerThreads) {
+        workerThread.join();
+    }
+
+    this->joinCores();
+}
+
+/**
+ * Get a Core of the Machine
+ *
+ * @param coreIndex Index of the Core
+ * @return Execution Scope of the Core, nullptr if the Machine has no such Core
+ */
+ExecutionScope* GuestMachine::getCore(uint32_t coreIndex) {
+    return (coreIndex < this->cores.size()) ? this->cores[coreIndex].get() : nullptr;
+}
+
+/**
+ * Get the number of Cores of the Machine
+ *
+ * @return Number of Cores
+ */
+uint32_t GuestMachine::getCoreCount() const {
+    return static_cast<uint32_t>(this->cores.size());
+}
+
+/**
+ * Print the State of every Core (Halt Reason, Program Counter, Instructions executed and Registers)
+ */
+void GuestMachine::printCores() {
+    for(uint32_t coreIndex = 0; coreIndex < this->cores.size(); coreIndex++) {
+        ExecutionScope* core = this->cores[coreIndex].get();
+
+        std::cout << std::endl << "Core " << coreIndex << " (Halt " << haltReasonName(core->getHaltReason()) << " at " << toHex(core->getPC(), 8) << ", "
+                  << core->getInstructionCount() << " Instructions executed):" << std::endl;
+        core->printRegisters();
+    }
+}
+
+/**
+ * Prepare the Cores for a run - the Data loaded by the host through Core 0 moved its Global Pointer, the other Cores start with the same one
+ */
+void GuestMachine::startCores() {
+    uint32_t globalPointer = this->cores[0]->getRegisterWord(28);
+
+    for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+        core->setRegisterWord(28, globalPointer);
+    }
+}
+
+/**
+ * Give every Core a private view of the Memory for a deterministic run, and stop the Cores at the Instructions that must run in Core order
+ * (a Breakpoint whose Callback only lets the Core through during the serial phase)
+ */
+void GuestMachine::isolateCores() {
+    ExecutionScope* firstCore = this->cores[0].get();
+
+    this->serializingAddresses.clear();
+
+    for(uint32_t address = firstCore->getTextStart(); address < firstCore->getTextEnd(); address += 4) {
+        uint32_t insValue;
+        firstCore->getMemory().readWord(address, insValue);
+
+        enum InstructionKind instructionKind = decodeInstruction(insValue).instructionKind;
+
+        if(instructionKind == KIND_LOAD_LINKED || instructionKind == KIND_STORE_CONDITIONAL || instructionKind == KIND_SYNC || instructionKind == KIND_SYSCALL) {
+            this->serializingAddresses.push_back(address);
+        }
+    }
+
+    for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+        core->getMemory().unshare();
+        core->getMemory().trackDirtyPages(true);
+
+        /* Every Page is reported dirty once tracking starts: the views all match the published Memory */
+        this->dirtyPages.clear();
+        core->getMemory().collectDirtyPages(this->dirtyPages);
+
+        for(uint32_t address : this->serializingAddresses) {
+            core->addBreakpoint(address);
+        }
+
+        core->setBreakpointCallback([this](ExecutionScope*, uint32_t) { return this->isSerialPhase; });
+    }
+}
+
+/**
+ * End a deterministic run - the Cores share the published Memory again and no longer stop at ll, sc, sync or syscall
+ */
+void GuestMachine::joinCores() {
+    for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+        for(uint32_t address : this->serializingAddresses) {
+            core->removeBreakpoint(address);
+        }
+
+        core->setBreakpointCallback(nullptr);
+        core->getMemory().trackDirtyPages(false);
+        core->getMemory().share(this->publishedMemory);
+    }
+}
+
+/**
+ * Publish the Bytes written by a range of Cores in Core order, then copy the published Pages into the view of every Core -
+ * each written Page is compared Byte by Byte with its published content from before the first Core of the range
+ *
+ * @param firstCore Index of the first Core whose writes are published
+ * @param endCore Index following the last Core whose writes are published
+ */
+void GuestMachine::publishWrites(uint32_t firstCore, uint32_t endCore) {
+    std::map<uint32_t, std::unique_ptr<uint8_t[]>> originalPages;
+    std::unique_ptr<uint8_t[]> corePage(new uint8_t[pageSize]);
+    std::unique_ptr<uint8_t[]> publishedPage(new uint8_t[pageSize]);
+
+    for(uint32_t coreIndex = firstCore; coreIndex < endCore; coreIndex++) {
+        GuestMemory& coreMemory = this->cores[coreIndex]->getMemory();
+
+        this->dirtyPages.clear();
+        coreMemory.collectDirtyPages(this->dirtyPages);
+
+        for(uint32_t pageNumber : this->dirtyPages) {
+            std::unique_ptr<uint8_t[]>& originalPage = originalPages[pageNumber];
+
+            if(originalPage == nullptr) {
+                originalPage.reset(new uint8_t[pageSize]);
+                this->publishedMemory.copyPage(pageNumber, originalPage.get());
+            }
+
+            coreMemory.copyPage(pageNumber, corePage.get());
+            this->publishedMemory.copyPage(pageNumber, publishedPage.get());
+
+            for(uint32_t byteIndex = 0; byteIndex < pageSize; byteIndex++) {
+                if(corePage[byteIndex] != originalPage[byteIndex]) {
+                    publishedPage[byteIndex] = corePage[byteIndex];
+                }
+            }
+
+            this->publishedMemory.writeBytes(pageNumber << pageBits, publishedPage.get(), pageSize);
+        }
+    }
+
+    for(auto& pageEntry : originalPages) {
+        this->publishedMemory.copyPage(pageEntry.first, publishedPage.get());
+
+        for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+            core->getMemory().writeBytes(pageEntry.first << pageBits, publishedPage.get(), pageSize);
+        }
+    }
+
+    /* The copies are not writes of the Cores: they are not published again */
+    for(std::unique_ptr<ExecutionScope>& core : this->cores) {
+        this->dirtyPages.clear();
+        core->getMemory().collectDirtyPages(this->dirtyPages);
+    }
+}
+
+/**
+ * Retrieves whether a Core can run more Instructions (it was only stopped by the end of its Quantum or at an Instruction that runs in Core order)
+ *
+ * @param coreIndex Index of the Core
+ * @return True if the Core has not halted for good
+ */
+bool GuestMachine::isRunnable(uint32_t coreIndex) {
+    enum HaltReason haltReason = this->cores[coreIndex]->getHaltReason();
+
+    return haltReason == NOT_HALTED || haltReason == HALT_STEP || haltReason == HALT_BREAKPOINT;
+}
+
+/**
+ * Retrieves whether a Core stopped at an Instruction that runs in Core order (ll, sc, sync, syscall)
+ *
+ * @param coreIndex Index of the Core
+ * @return True if the next Instruction of the Core runs in the serial phase
+ */
+bool GuestMachine::isSerializing(uint32_t coreIndex) {
+    return this->cores[coreIndex]->isBreakpoint(toUnsigned(this->cores[coreIndex]->getPC()));
+}
@@ -0,0 +1,1100 @@
+#include "../includes/mips_emulator.h"
+
+#if defined(__linux__) && defined(__x86_64__)
+    #include <sys/mman.h>
+    #include <ucontext.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    #include <immintrin.h>
+#endif
+
+thread_local MemoryFault memoryFault = { 0, 0, false, 0 };
+
+/**
+ * Size in Bytes of the Fast Memory reservation (the whole 32-bit Guest Address Space)
+ */
+static const uint64_t fastMemorySize = 1ull << 32;
+
+/**
+ * Maximum number of Fast Memory reservations alive at the same time
+ */
+static const int maxFastMemories = 256;
+
+static std::atomic<GuestMemory*> fastMemories[maxFastMemories];
+static std::once_flag faultHandlerInstalled;
+
+#if defined(__linux__) && defined(__x86_64__)
+    static struct sigaction previousFaultAction;
+#endif
+
+/**
+ * Function that stores host Words in Big-Endian order at a Host Pointer
+ */
+typedef void (*BulkStoreFunction)(uint8_t*, const uint32_t*, size_t);
+
+/**
+ * Store host Words in Big-Endian order at a Host Pointer, one Word at a time
+ *
+ * @param hostPointer Pointer to the first Byte of the first Word
+ * @param wordValues Values of the Words
+ * @param wordCount Number of Words
+ */
+static void storeWordsScalar(uint8_t* hostPointer, const uint32_t* wordValues, size_t wordCount) {
+    for(size_t wordIndex = 0; wordIndex < wordCount; wordIndex++) {
+        storeBigEndian(hostPointer + 4 * wordIndex, wordValues[wordIndex]);
+    }
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    /**
+     * Store host Words in Big-Endian order at a Host Pointer, 4 Words at a time (SSSE3 pshufb)
+     *
+     * @param hostPointer Pointer to the first Byte of the first Word
+     * @param wordValues Values of the Words
+     * @param wordCount Number of Words
+     */
+    __attribute__((target("ssse3")))
+    static void storeWordsSSSE3(uint8_t* hostPointer, const uint32_t* wordValues, size_t wordCount) {
+        const __m128i swapMask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        size_t wordIndex = 0;
+
+        for(; wordIndex + 4 <= wordCount; wordIndex += 4) {
+            __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(wordValues + wordIndex));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(hostPointer + 4 * wordIndex), _mm_shuffle_epi8(words, swapMask));
+        }
+
+        storeWordsScalar(hostPointer + 4 * wordIndex, wordValues + wordIndex, wordCount - wordIndex);
+    }
+
+    /**
+     * Store host Words in Big-Endian order at a Host Pointer, 8 Words at a time (AVX2 vpshufb)
+     *
+     * @param hostPointer Pointer to the first Byte of the first Word
+     * @param wordValues Values of the Words
+     * @param wordCount Number of Words
+     */
+    __attribute__((target("avx2")))
+    static void storeWordsAVX2(uint8_t* hostPointer, const uint32_t* wordValues, size_t wordCount) {
+        const __m256i swapMask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                  3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        size_t wordIndex = 0;
+
+        for(; wordIndex + 8 <= wordCount; wordIndex += 8) {
+            __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(wordValues + wordIndex));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hostPointer + 4 * wordIndex), _mm256_shuffle_epi8(words, swapMask));
+        }
+
+        storeWordsScalar(hostPointer + 4 * wordIndex, wordValues + wordIndex, wordCount - wordIndex);
+    }
+#endif
+
+/**
+ * Select the fastest Bulk Store supported by the host CPU (the Words are already Big-Endian on Big-Endian hosts)
+ *
+ * @return Bulk Store Function
+ */
+static BulkStoreFunction selectBulkStore() {
+    #if defined(__x86_64__) && defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if(__builtin_cpu_supports("avx2")) return storeWordsAVX2;
+        if(__builtin_cpu_supports("ssse3")) return storeWordsSSSE3;
+    #endif
+
+    return storeWordsScalar;
+}
+
+static const BulkStoreFunction storeWords = selectBulkStore();
+
+/**
+ * PageTable Destructor - Releases every allocated Page (once the last Memory sharing the Page Table is destroyed)
+ */
+PageTable::~PageTable() {
+    for(auto& pageEntry : this->pages) {
+        delete pageEntry.second;
+    }
+}
+
+/**
+ * GuestMemory Constructor - Initializes an empty Page Table and empty Software TLBs
+ */
+GuestMemory::GuestMemory() : pageTable(std::make_shared<PageTable>()) {
+    this->flushTLB();
+}
+
+/**
+ * GuestMemory Constructor - Initializes the Guest Memory using the selected Backend
+ *
+ * @param memoryBackend Backend used to store the Guest Memory (falls back to PAGED_MEMORY if FAST_MEMORY is not available)
+ */
+GuestMemory::GuestMemory(enum MemoryBackend memoryBackend) : pageTable(std::make_shared<PageTable>()) {
+    this->flushTLB();
+
+    if(memoryBackend == FAST_MEMORY && !this->reserveFastMemory()) {
+        std::cout << "Fast Memory not available, using Paged Memory!" << std::endl;
+    }
+}
+
+/**
+ * GuestMemory Destructor - Releases the Page Table (the Pages are released with the last Memory sharing them) and the Fast Memory reservation
+ */
+GuestMemory::~GuestMemory() {
+    #if defined(__linux__) && defined(__x86_64__)
+        if(this->fastBase != nullptr) {
+            for(int memoryIndex = 0; memoryIndex < maxFastMemories; memoryIndex++) {
+                GuestMemory* expected = this;
+                fastMemories[memoryIndex].compare_exchange_strong(expected, nullptr);
+            }
+
+            munmap(this->fastBase, fastMemorySize);
+            delete[] this->fastPermissions;
+        }
+    #endif
+}
+
+/**
+ * Get the Backend used to store the Guest Memory
+ *
+ * @return Backend used to store the Guest Memory
+ */
+enum MemoryBackend GuestMemory::getBackend() const {
+    return (this->fastBase != nullptr) ? FAST_MEMORY : PAGED_MEMORY;
+}
+
+/**
+ * Read a Byte from the Guest Memory
+ *
+ * @param address Guest Address of the Byte
+ * @param byteValue Value of the Byte read (0 if the Page is not mapped)
+ * @return True if the Page is mapped and readable, otherwise return False
+ */
+bool GuestMemory::readByte(uint32_t address, uint8_t& byteValue) {
+    uint32_t value;
+
+    if(this->fastBase != nullptr) {
+        value = this->fastBase[address];
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        bool isReadable = !memoryFault.pending || this->resolveFault(address, 1, value);
+
+        byteValue = value;
+        return isReadable;
+    }
+
+    const TLBEntry& entry = this->readTLB[(address >> pageBits) & (tlbEntries - 1)];
+
+    if(entry.pageNumber == (address >> pageBits)) {
+        byteValue = __atomic_load_n(&entry.hostPage[address & (pageSize - 1)], __ATOMIC_RELAXED);
+        return true;
+    }
+
+    bool isReadable = this->readSlow(address, 1, value);
+
+    byteValue = value;
+    return isReadable;
+}
+
+/**
+ * Write a Byte into the Guest Memory
+ *
+ * @param address Guest Address of the Byte
+ * @param byteValue Value of the Byte to write
+ * @return True if the Byte was written, False if the Page is not writable
+ */
+bool GuestMemory::writeByte(uint32_t address, uint8_t byteValue) {
+    uint32_t value = byteValue;
+
+    if(this->fastBase != nullptr) {
+        this->fastBase[address] = byteValue;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        return !memoryFault.pending || this->resolveFault(address, 1, value);
+    }
+
+    const TLBEntry& entry = this->writeTLB[(address >> pageBits) & (tlbEntries - 1)];
+
+    if(entry.pageNumber == (address >> pageBits)) {
+        __atomic_store_n(&entry.hostPage[address & (pageSize - 1)], byteValue, __ATOMIC_RELAXED);
+        return true;
+    }
+
+    return this->writeSlow(address, 1, value);
+}
+
+/**
+ * Write an array of Words into the Guest Memory - the Words are byte-swapped a vector at a time straight into the Host Pages,
+ * watched Pages are written one Word at a time so that every Watchpoint is reported
+ *
+ * @param address Guest Address of the first Word (must be aligned)
+ * @param wordValues Values of the Words to write
+ * @param wordCount Number of Words to write
+ * @return True if every Word was written, False if a Page is not writable (the following Words are not written)
+ */
+bool GuestMemory::writeWords(uint32_t address, const uint32_t* wordValues, size_t wordCount) {
+    while(wordCount > 0) {
+        size_t pageWords = std::min<size_t>(wordCount, (pageSize - (address & (pageSize - 1))) / 4);
+        uint8_t* hostPage = this->findBulkPage(address >> pageBits);
+
+        if(hostPage != nullptr) {
+            storeWords(hostPage + (address & (pageSize - 1)), wordValues, pageWords);
+        } else {
+            for(size_t wordIndex = 0; wordIndex < pageWords; wordIndex++) {
+                if(!this->writeWord(address + 4 * wordIndex, wordValues[wordIndex])) return false;
+            }
+        }
+
+        address += 4 * pageWords;
+        wordValues += pageWords;
+        wordCount -= pageWords;
+    }
+
+    return true;
+}
+
+/**
+ * Write an array of Bytes into the Guest Memory - the Bytes are copied straight into the Host Pages,
+ * watched Pages are written one Byte at a time so that every Watchpoint is reported
+ *
+ * @param address Guest Address of the first Byte
+ * @param byteValues Values of the Bytes to write
+ * @param byteCount Number of Bytes to write
+ * @return True if every Byte was written, False if a Page is not writable (the following Bytes are not written)
+ */
+bool GuestMemory::writeBytes(uint32_t address, const uint8_t* byteValues, size_t byteCount) {
+    while(byteCount > 0) {
+        size_t pageBytes = std::min<size_t>(byteCount, pageSize - (address & (pageSize - 1)));
+        uint8_t* hostPage = this->findBulkPage(address >> pageBits);
+
+        if(hostPage != nullptr) {
+            std::memcpy(hostPage + (address & (pageSize - 1)), byteValues, pageBytes);
+        } else {
+            for(size_t byteIndex = 0; byteIndex < pageBytes; byteIndex++) {
+                if(!this->writeByte(address + byteIndex, byteValues[byteIndex])) return false;
+            }
+        }
+
+        address += pageBytes;
+        byteValues += pageBytes;
+        byteCount -= pageBytes;
+    }
+
+    return true;
+}
+
+/**
+ * Fill a range of the Guest Memory with a Word - the Word is byte-swapped once and stored straight into the Host Pages,
+ * watched Pages are written one Word at a time so that every Watchpoint is reported
+ *
+ * @param address Guest Address of the first Word (must be aligned)
+ * @param wordValue Value of the Words to write
+ * @param wordCount Number of Words to write
+ * @return True if every Word was written, False if a Page is not writable (the following Words are not written)
+ */
+bool GuestMemory::fillWords(uint32_t address, uint32_t wordValue, size_t wordCount) {
+    uint8_t wordBytes[4];
+    storeBigEndian(wordBytes, wordValue);
+
+    while(wordCount > 0) {
+        size_t pageWords = std::min<size_t>(wordCount, (pageSize - (address & (pageSize - 1))) / 4);
+        uint8_t* hostPage = this->findBulkPage(address >> pageBits);
+
+        if(hostPage != nullptr) {
+            uint8_t* hostPointer = hostPage + (address & (pageSize - 1));
+
+            if(wordBytes[0] == wordBytes[1] && wordBytes[0] == wordBytes[2] && wordBytes[0] == wordBytes[3]) {
+                std::memset(hostPointer, wordBytes[0], 4 * pageWords);
+            } else {
+                for(size_t wordIndex = 0; wordIndex < pageWords; wordIndex++) {
+                    std::memcpy(hostPointer + 4 * wordIndex, wordBytes, 4);
+                }
+            }
+        } else {
+            for(size_t wordIndex = 0; wordIndex < pageWords; wordIndex++) {
+                if(!this->writeWord(address + 4 * wordIndex, wordValue)) return false;
+            }
+        }
+
+        address += 4 * pageWords;
+        wordCount -= pageWords;
+    }
+
+    return true;
+}
+
+/**
+ * Read from the Guest Memory walking the Page Table - the Read TLB is refilled unless the Page is watched for reads
+ *
+ * @param address Guest Address of the access
+ * @param size Size of the access (1 or 4 Bytes)
+ * @param value Value read (0 if the Page is not mapped or not readable)
+ * @return True if the Page is mapped and readable, otherwise return False
+ */
+bool GuestMemory::readSlow(uint32_t address, uint32_t size, uint32_t& value) {
+    uint32_t pageNumber = address >> pageBits;
+    MemoryPage* page = this->findPage(pageNumber);
+
+    if(page == nullptr || !(page->permissions & PAGE_READ)) {
+        value = 0;
+        return false;
+    }
+
+    uint8_t* hostPointer = page->data + (address & (pageSize - 1));
+    value = (size == 4) ? loadSharedWord(hostPointer) : __atomic_load_n(hostPointer, __ATOMIC_RELAXED);
+
+    if(page->watchFlags & WATCH_READ) {
+        this->reportWatch(address, size, false, value, value);
+    } else {
+        TLBEntry& entry = this->readTLB[pageNumber & (tlbEntries - 1)];
+        entry.pageNumber = pageNumber;
+        entry.hostPage = page->data;
+    }
+
+    return true;
+}
+
+/**
+ * Write into the Guest Memory walking the Page Table (the Page is allocated on the first write) - the Write TLB is refilled unless the Page is watched for writes
+ *
+ * @param address Guest Address of the access
+ * @param size Size of the access (1 or 4 Bytes)
+ * @param value Value to write
+ * @return True if the Value was written, False if the Page is not writable
+ */
+bool GuestMemory::writeSlow(uint32_t address, uint32_t size, uint32_t value) {
+    uint32_t pageNumber = address >> pageBits;
+    MemoryPage* page = this->findPage(pageNumber);
+
+    if(page == nullptr) {
+        page = this->allocatePage(pageNumber, PAGE_READ | PAGE_WRITE);
+    } else if(!(page->permissions & PAGE_WRITE)) {
+        return false;
+    }
+
+    uint8_t* hostPointer = page->data + (address & (pageSize - 1));
+    uint32_t oldValue = (size == 4) ? loadSharedWord(hostPointer) : __atomic_load_n(hostPointer, __ATOMIC_RELAXED);
+
+    if(size == 4) {
+        storeSharedWord(hostPointer, value);
+    } else {
+        __atomic_store_n(hostPointer, static_cast<uint8_t>(value), __ATOMIC_RELAXED);
+    }
+
+    this->markDirty(pageNumber);
+
+    if(page->watchFlags & WATCH_WRITE) {
+        this->reportWatch(address, size, true, oldValue, value);
+    } else {
+        TLBEntry& entry = this->writeTLB[pageNumber & (tlbEntries - 1)];
+        entry.pageNumber = pageNumber;
+        entry.hostPage = page->data;
+    }
+
+    return true;
+}
+
+/**
+ * Allocate the Pages that cover a range of the Guest Memory
+ *
+ * @param address Guest Address of the first Byte of the range
+ * @param size Size in Bytes of the range
+ * @param permissions Access Permissions given to the Pages (PagePermission flags)
+ */
+void GuestMemory::allocatePages(uint32_t address, uint32_t size, int permissions) {
+    if(size == 0) return;
+
+    uint32_t firstPage = address >> pageBits;
+    uint32_t lastPage = (address + (size - 1)) >> pageBits;
+
+    for(uint32_t pageNumber = firstPage; pageNumber <= lastPage && pageNumber >= firstPage; pageNumber++) {
+        if(this->fastBase != nullptr) {
+            this->fastPermissions[pageNumber] = (this->fastPermissions[pageNumber] & (pageWatchMask | pageClean)) | pageCommitted | permissions;
+            this->protectFastPage(pageNumber);
+            continue;
+        }
+
+        MemoryPage* page = this->findPage(pageNumber);
+
+        if(page == nullptr) {
+            this->allocatePage(pageNumber, permissions);
+        } else if(page->permissions != permissions) {
+            page->permissions = permissions;
+            this->invalidateTLB(pageNumber);
+        }
+    }
+}
+
+/**
+ * Change the Access Permissions of the Pages that cover a range of the Guest Memory
+ *
+ * @param address Guest Address of the first Byte of the range
+ * @param size Size in Bytes of the range
+ * @param permissions New Access Permissions of the Pages (PagePermission flags)
+ */
+void GuestMemory::setPermissions(uint32_t address, uint32_t size, int permissions) {
+    if(size == 0) return;
+
+    uint32_t firstPage = address >> pageBits;
+    uint32_t lastPage = (address + (size - 1)) >> pageBits;
+
+    for(uint32_t pageNumber = firstPage; pageNumber <= lastPage && pageNumber >= firstPage; pageNumber++) {
+        if(this->fastBase != nullptr) {
+            if(this->fastPermissions[pageNumber] & pageCommitted) {
+                this->fastPermissions[pageNumber] = (this->fastPermissions[pageNumber] & (pageWatchMask | pageClean)) | pageCommitted | permissions;
+                this->protectFastPage(pageNumber);
+            }
+
+            continue;
+        }
+
+        MemoryPage* page = this->findPage(pageNumber);
+
+        if(page != nullptr) {
+            page->permissions = permissions;
+            this->invalidateTLB(pageNumber);
+        }
+    }
+}
+
+/**
+ * Get the Access Permissions of the Page that contains the Address
+ *
+ * @param address Guest Address
+ * @return Access Permissions of the Page (PAGE_NONE if the Page is not mapped)
+ */
+int GuestMemory::getPermissions(uint32_t address) {
+    if(this->fastBase != nullptr) {
+        uint8_t pagePermissions = this->fastPermissions[address >> pageBits];
+
+        return (pagePermissions & pageCommitted) ? (pagePermissions & (PAGE_READ | PAGE_WRITE)) : PAGE_NONE;
+    }
+
+    MemoryPage* page = this->findPage(address >> pageBits);
+
+    return (page != nullptr) ? page->permissions : PAGE_NONE;
+}
+
+/**
+ * Retrieves whether the Page that contains the Address is mapped
+ *
+ * @param address Guest Address
+ * @return True if the Page is mapped, otherwise return False
+ */
+bool GuestMemory::isMapped(uint32_t address) {
+    if(this->fastBase != nullptr) {
+        return this->fastPermissions[address >> pageBits] & pageCommitted;
+    }
+
+    return this->findPage(address >> pageBits) != nullptr;
+}
+
+/**
+ * Watch a range of the Guest Memory - the Pages of the range leave the fast path for the watched accesses
+ *
+ * @param address Guest Address of the first watched Byte
+ * @param size Number of watched Bytes
+ * @param watchType Accesses that trigger the Watchpoint (WatchType flags)
+ */
+void GuestMemory::addWatchpoint(uint32_t address, uint32_t size, int watchType) {
+    if(size == 0) return;
+
+    this->watchpoints.push_back({ address, size, watchType });
+    this->updateWatchFlags(address, size);
+}
+
+/**
+ * Stop watching a range of the Guest Memory
+ *
+ * @param address Guest Address of the first watched Byte
+ * @param size Number of watched Bytes
+ * @param watchType Accesses that trigger the Watchpoint (WatchType flags)
+ * @return True if the Watchpoint was removed, False if there was no such Watchpoint
+ */
+bool GuestMemory::removeWatchpoint(uint32_t address, uint32_t size, int watchType) {
+    for(auto posWatchpoint = this->watchpoints.begin(); posWatchpoint != this->watchpoints.end(); posWatchpoint++) {
+        if(posWatchpoint->address == address && posWatchpoint->size == size && posWatchpoint->watchType == watchType) {
+            this->watchpoints.erase(posWatchpoint);
+            this->updateWatchFlags(address, size);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Set the Function called on every watched access
+ *
+ * @param watchHandler Function called with the Address, the Size, the Type of access, the old and the new Value
+ */
+void GuestMemory::setWatchHandler(MemoryWatchHandler watchHandler) {
+    this->watchHandler = watchHandler;
+}
+
+/**
+ * Calculate the Accesses watched on a Page
+ *
+ * @param pageNumber Guest Page Number
+ * @return Accesses watched on the Page (WatchType flags)
+ */
+int GuestMemory::calculateWatchFlags(uint32_t pageNumber) {
+    int watchFlags = 0;
+
+    for(const Watchpoint& watchpoint : this->watchpoints) {
+        uint32_t firstPage = watchpoint.address >> pageBits;
+        uint32_t lastPage = (watchpoint.address + (watchpoint.size - 1)) >> pageBits;
+
+        if(pageNumber >= firstPage && pageNumber <= lastPage) {
+            watchFlags |= watchpoint.watchType;
+        }
+    }
+
+    return watchFlags;
+}
+
+/**
+ * Recalculate the watched Accesses of the Pages that cover a range, and drop them from the TLBs
+ *
+ * @param address Guest Address of the first Byte of the range
+ * @param size Size in Bytes of the range
+ */
+void GuestMemory::updateWatchFlags(uint32_t address, uint32_t size) {
+    uint32_t firstPage = address >> pageBits;
+    uint32_t lastPage = (address + (size - 1)) >> pageBits;
+
+    for(uint32_t pageNumber = firstPage; pageNumber <= lastPage && pageNumber >= firstPage; pageNumber++) {
+        int watchFlags = this->calculateWatchFlags(pageNumber);
+
+        if(this->fastBase != nullptr) {
+            this->fastPermissions[pageNumber] = (this->fastPermissions[pageNumber] & ~pageWatchMask) | (watchFlags << pageWatchShift);
+            this->protectFastPage(pageNumber);
+
+            continue;
+        }
+
+        MemoryPage* page = this->findPage(pageNumber);
+
+        if(page != nullptr) {
+            page->watchFlags = watchFlags;
+            this->invalidateTLB(pageNumber);
+        }
+    }
+}
+
+/**
+ * Call the Watch Handler if the access overlaps a Watchpoint of the matching Type
+ *
+ * @param address Guest Address of the access
+ * @param size Size of the access (1 or 4 Bytes)
+ * @param isWrite True if the access is a write
+ * @param oldValue Value before the access
+ * @param newValue Value after the access
+ */
+void GuestMemory::reportWatch(uint32_t address, uint32_t size, bool isWrite, uint32_t oldValue, uint32_t newValue) {
+    int accessType = isWrite ? WATCH_WRITE : WATCH_READ;
+
+    for(const Watchpoint& watchpoint : this->watchpoints) {
+        uint64_t watchEnd = static_cast<uint64_t>(watchpoint.address) + watchpoint.size;
+        uint64_t accessEnd = static_cast<uint64_t>(address) + size;
+
+        if((watchpoint.watchType & accessType) && address < watchEnd && watchpoint.address < accessEnd) {
+            if(this->watchHandler) {
+                this->watchHandler(address, size, isWrite, oldValue, newValue);
+            }
+
+            return;
+        }
+    }
+}
+
+/**
+ * Replace a Word if it still holds an expected Value - atomic with respect to the other Cores sharing the Page Table
+ * (the Fast Memory is never shared: the Word is read and written in place)
+ *
+ * @param address Guest Address of the Word (must be aligned)
+ * @param expectedValue Value the Word must hold
+ * @param newValue Value written when the Word holds the expected Value
+ * @return True if the Word was replaced, False if it held another Value or is not readable and writable
+ */
+bool GuestMemory::compareExchangeWord(uint32_t address, uint32_t expectedValue, uint32_t newValue) {
+    uint32_t pageNumber = address >> pageBits;
+    MemoryPage* page = nullptr;
+
+    /* A Page that is not mapped reads 0, it is allocated by the first write */
+    if(this->fastBase == nullptr) {
+        page = this->findPage(pageNumber);
+
+        if(page == nullptr) {
+            page = this->allocatePage(pageNumber, PAGE_READ | PAGE_WRITE);
+        }
+    }
+
+    /* Watched Pages go through the regular accesses so that the Watchpoints are reported */
+    if(page == nullptr || page->watchFlags != 0) {
+        uint32_t wordValue;
+        bool isCommitted = (page != nullptr) || (this->fastPermissions[pageNumber] & pageCommitted);
+
+        /* A Fast Memory Page that is not committed reads 0 too, the write commits it */
+        if((!this->readWord(address, wordValue) && isCommitted) || wordValue != expectedValue) {
+            return false;
+        }
+
+        return this->writeWord(address, newValue);
+    }
+
+    if((page->permissions & (PAGE_READ | PAGE_WRITE)) != (PAGE_READ | PAGE_WRITE)) {
+        return false;
+    }
+
+    uint32_t expectedWord, newWord;
+    storeBigEndian(reinterpret_cast<uint8_t*>(&expectedWord), expectedValue);
+    storeBigEndian(reinterpret_cast<uint8_t*>(&newWord), newValue);
+
+    uint32_t* hostWord = reinterpret_cast<uint32_t*>(page->data + (address & (pageSize - 1)));
+
+    if(!__atomic_compare_exchange_n(hostWord, &expectedWord, newWord, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+        return false;
+    }
+
+    this->markDirty(pageNumber);
+
+    return true;
+}
+
+/**
+ * Use the Page Table of another Memory - both Memories then see the same Pages, each one keeps its own TLBs, Watchpoints and dirty Pages
+ * (the Pages of this Memory are released)
+ *
+ * @param sourceMemory Memory whose Page Table is shared (must use the Paged Memory)
+ */
+void GuestMemory::share(GuestMemory& sourceMemory) {
+    if(this->fastBase != nullptr || sourceMemory.fastBase != nullptr) {
+        std::cout << "Fast Memory cannot be shared!" << std::endl;
+        return;
+    }
+
+    this->pageTable = sourceMemory.pageTable;
+    this->flushTLB();
+}
+
+/**
+ * Stop sharing the Page Table - this Memory gets a private copy of the shared Pages, the writes of the other Memories are no longer seen
+ */
+void GuestMemory::unshare() {
+    if(this->fastBase != nullptr) {
+        return;
+    }
+
+    std::shared_ptr<PageTable> privateTable = std::make_shared<PageTable>();
+
+    {
+        std::lock_guard<std::mutex> pageGuard(this->pageTable->pageLock);
+
+        for(auto& pageEntry : this->pageTable->pages) {
+            MemoryPage* page = new MemoryPage(*pageEntry.second);
+            page->watchFlags = this->calculateWatchFlags(pageEntry.first);
+
+            privateTable->pages[pageEntry.first] = page;
+        }
+    }
+
+    this->pageTable = privateTable;
+    this->flushTLB();
+}
+
+/**
+ * Invalidate every Entry of the Read and Write TLBs
+ */
+void GuestMemory::flushTLB() {
+    for(uint32_t entryIndex = 0; entryIndex < tlbEntries; entryIndex++) {
+        this->readTLB[entryIndex] = { invalidTag, nullptr };
+        this->writeTLB[entryIndex] = { invalidTag, nullptr };
+    }
+}
+
+/**
+ * Walk the Page Table looking for a Page
+ *
+ * @param pageNumber Guest Page Number
+ * @return Pointer to the Page, nullptr if the Page is not mapped
+ */
+MemoryPage* GuestMemory::findPage(uint32_t pageNumber) {
+    std::lock_guard<std::mutex> pageGuard(this->pageTable->pageLock);
+    auto posPage = this->pageTable->pages.find(pageNumber);
+
+    if(posPage != this->pageTable->pages.end()) {
+        return posPage->second;
+    }
+
+    return nullptr;
+}
+
+/**
+ * Start or stop tracking the Pages written - when the tracking starts every mapped Page is reported dirty by the next collection
+ *
+ * @param isTracking True to track the written Pages, False to stop tracking them
+ */
+void GuestMemory::trackDirtyPages(bool isTracking) {
+    if(isTracking == (this->dirtyBitmap != nullptr)) return;
+
+    if(!isTracking) {
+        std::vector<uint32_t> pageNumbers;
+        this->collectDirtyPages(pageNumbers);
+
+        /* Clean Pages get their write access back */
+        if(this->fastBase != nullptr) {
+            for(uint64_t pageNumber = 0; pageNumber < (1u << (32 - pageBits)); pageNumber++) {
+                if(this->fastPermissions[pageNumber] & pageClean) {
+                    this->fastPermissions[pageNumber] &= ~pageClean;
+                    this->protectFastPage(pageNumber);
+                }
+            }
+        }
+
+        this->dirtyBitmap.reset();
+        this->dirtyList.reset();
+        this->dirtyCount = 0;
+
+        return;
+    }
+
+    this->dirtyBitmap.reset(new uint64_t[(1u << (32 - pageBits)) / 64]());
+    this->dirtyList.reset(new uint32_t[1u << (32 - pageBits)]);
+    this->dirtyCount = 0;
+
+    if(this->fastBase != nullptr) {
+        for(uint64_t pageNumber = 0; pageNumber < (1u << (32 - pageBits)); pageNumber++) {
+            if(this->fastPermissions[pageNumber] & pageCommitted) this->markDirty(pageNumber);
+        }
+    } else {
+        std::lock_guard<std::mutex> pageGuard(this->pageTable->pageLock);
+
+        for(auto& pageEntry : this->pageTable->pages) {
+            this->markDirty(pageEntry.first);
+        }
+    }
+}
+
+/**
+ * Collect the Pages written since the last collection, then mark every Page clean again
+ *
+ * @param pageNumbers Vector the dirty Page Numbers are appended to (in the order of their first write)
+ */
+void GuestMemory::collectDirtyPages(std::vector<uint32_t>& pageNumbers) {
+    if(this->dirtyBitmap == nullptr) return;
+
+    for(uint32_t dirtyIndex = 0; dirtyIndex < this->dirtyCount; dirtyIndex++) {
+        uint32_t pageNumber = this->dirtyList[dirtyIndex];
+        this->dirtyBitmap[pageNumber >> 6] &= ~(1ull << (pageNumber & 63));
+
+        pageNumbers.push_back(pageNumber);
+
+        /* The next write to the Page must miss the fast path again */
+        if(this->fastBase != nullptr) {
+            if((this->fastPermissions[pageNumber] & (pageCommitted | PAGE_WRITE)) == (pageCommitted | PAGE_WRITE)) {
+                this->fastPermissions[pageNumber] |= pageClean;
+                this->protectFastPage(pageNumber);
+            }
+        } else {
+            this->invalidateTLB(pageNumber);
+        }
+    }
+
+    this->dirtyCount = 0;
+}
+
+/**
+ * Copy the content of a Page, bypassing its Permissions and Watchpoints
+ *
+ * @param pageNumber Guest Page Number
+ * @param pageData Buffer of pageSize Bytes the content is copied to (zero-filled if the Page is not mapped)
+ */
+void GuestMemory::copyPage(uint32_t pageNumber, uint8_t* pageData) {
+    if(this->fastBase != nullptr) {
+        uint8_t pagePermissions = this->fastPermissions[pageNumber];
+        uint8_t* hostPage = this->fastBase + (static_cast<uint64_t>(pageNumber) << pageBits);
+
+        if(!(pagePermissions & pageCommitted)) {
+            std::memset(pageData, 0, pageSize);
+            return;
+        }
+
+        #if defined(__linux__) && defined(__x86_64__)
+            /* Pages watched for reads are not readable by the host */
+            if(pagePermissions & (WATCH_READ << pageWatchShift)) {
+                mprotect(hostPage, pageSize, PROT_READ);
+                std::memcpy(pageData, hostPage, pageSize);
+                this->protectFastPage(pageNumber);
+
+                return;
+            }
+        #endif
+
+        std::memcpy(pageData, hostPage, pageSize);
+        return;
+    }
+
+    MemoryPage* page = this->findPage(pageNumber);
+
+    if(page != nullptr) {
+        std::memcpy(pageData, page->data, pageSize);
+    } else {
+        std::memset(pageData, 0, pageSize);
+    }
+}
+
+/**
+ * Find the Host Page a bulk write can store into directly - the Page is allocated (committed with Fast Memory) if it is not mapped
+ *
+ * @param pageNumber Guest Page Number
+ * @return Host Pointer to the first Byte of the Page, nullptr if the Page is not writable or is watched
+ */
+uint8_t* GuestMemory::findBulkPage(uint32_t pageNumber) {
+    if(this->fastBase != nullptr) {
+        uint8_t& pagePermissions = this->fastPermissions[pageNumber];
+
+        if(pagePermissions & pageWatchMask) {
+            return nullptr;
+        }
+
+        if(!(pagePermissions & pageCommitted)) {
+            pagePermissions = pageCommitted | PAGE_READ | PAGE_WRITE;
+            this->protectFastPage(pageNumber);
+        }
+
+        if(!(pagePermissions & PAGE_WRITE)) {
+            return nullptr;
+        }
+
+        if(pagePermissions & pageClean) {
+            pagePermissions &= ~pageClean;
+            this->protectFastPage(pageNumber);
+        }
+
+        this->markDirty(pageNumber);
+        return this->fastBase + (static_cast<uint64_t>(pageNumber) << pageBits);
+    }
+
+    MemoryPage* page = this->findPage(pageNumber);
+
+    if(page == nullptr) {
+        page = this->allocatePage(pageNumber, PAGE_READ | PAGE_WRITE);
+    }
+
+    if(!(page->permissions & PAGE_WRITE) || page->watchFlags != 0) {
+        return nullptr;
+    }
+
+    this->markDirty(pageNumber);
+    return page->data;
+}
+
+/**
+ * Allocate a zero-filled Page and add it to the Page Table - another Core sharing the Page Table may have allocated it first
+ *
+ * @param pageNumber Guest Page Number
+ * @param permissions Access Permissions given to the Page (PagePermission flags)
+ * @return Pointer to the Page
+ */
+MemoryPage* GuestMemory::allocatePage(uint32_t pageNumber, int permissions) {
+    std::lock_guard<std::mutex> pageGuard(this->pageTable->pageLock);
+    MemoryPage*& page = this->pageTable->pages[pageNumber];
+
+    if(page == nullptr) {
+        page = new MemoryPage();
+        page->permissions = permissions;
+        page->watchFlags = this->calculateWatchFlags(pageNumber);
+    }
+
+    this->invalidateTLB(pageNumber);
+
+    return page;
+}
+
+/**
+ * Invalidate the TLB Entries that can hold a Page
+ *
+ * @param pageNumber Guest Page Number
+ */
+void GuestMemory::invalidateTLB(uint32_t pageNumber) {
+    uint32_t entryIndex = pageNumber & (tlbEntries - 1);
+
+    if(this->readTLB[entryIndex].pageNumber == pageNumber) {
+        this->readTLB[entryIndex] = { invalidTag, nullptr };
+    }
+
+    if(this->writeTLB[entryIndex].pageNumber == pageNumber) {
+        this->writeTLB[entryIndex] = { invalidTag, nullptr };
+    }
+}
+
+/**
+ * Reserve the whole 32-bit Guest Address Space with no access, Pages are committed on demand
+ *
+ * @return True if the reservation succeeded, otherwise return False
+ */
+bool GuestMemory::reserveFastMemory() {
+    #if defined(__linux__) && defined(__x86_64__)
+        if(sysconf(_SC_PAGESIZE) != pageSize) {
+            return false;
+        }
+
+        void* reservation = mmap(nullptr, fastMemorySize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if(reservation == MAP_FAILED) {
+            return false;
+        }
+
+        this->fastBase = static_cast<uint8_t*>(reservation);
+
+        int memoryIndex = 0;
+        for(; memoryIndex < maxFastMemories; memoryIndex++) {
+            GuestMemory* expected = nullptr;
+
+            if(fastMemories[memoryIndex].compare_exchange_strong(expected, this)) {
+                break;
+            }
+        }
+
+        if(memoryIndex == maxFastMemories) {
+            munmap(reservation, fastMemorySize);
+            this->fastBase = nullptr;
+
+            return false;
+        }
+
+        this->fastPermissions = new uint8_t[1u << (32 - pageBits)]();
+
+        std::call_once(faultHandlerInstalled, []() {
+            struct sigaction faultAction;
+            std::memset(&faultAction, 0, sizeof(faultAction));
+
+            faultAction.sa_sigaction = GuestMemory::handleFault;
+            faultAction.sa_flags = SA_SIGINFO | SA_NODEFER;
+            sigemptyset(&faultAction.sa_mask);
+
+            sigaction(SIGSEGV, &faultAction, &previousFaultAction);
+        });
+
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/**
+ * Apply the Permissions of a Fast Memory Page to its Host Page - watched accesses and writes to clean Pages are removed so that they fault
+ *
+ * @param pageNumber Guest Page Number
+ */
+void GuestMemory::protectFastPage(uint32_t pageNumber) {
+    #if defined(__linux__) && defined(__x86_64__)
+        uint8_t pagePermissions = this->fastPermissions[pageNumber];
+        int watchFlags = (pagePermissions & pageWatchMask) >> pageWatchShift;
+        int hostProtection = PROT_NONE;
+
+        if(pagePermissions & pageCommitted) {
+            if(pagePermissions & PAGE_READ) hostProtection |= PROT_READ;
+            if(pagePermissions & PAGE_WRITE) hostProtection |= PROT_WRITE;
+        }
+
+        if(watchFlags & WATCH_READ) hostProtection = PROT_NONE;
+        if(watchFlags & WATCH_WRITE) hostProtection &= ~PROT_WRITE;
+        if(pagePermissions & pageClean) hostProtection &= ~PROT_WRITE;
+
+        mprotect(this->fastBase + (static_cast<uint64_t>(pageNumber) << pageBits), pageSize, hostProtection);
+    #endif
+}
+
+/**
+ * Handle the pending Fault of an access - a permitted access to a watched Page is reported to the Watch Handler,
+ * any other access fails (a refused write is undone), then the Page is protected again
+ *
+ * @param address Guest Address of the access
+ * @param size Size of the access (1 or 4 Bytes)
+ * @param value Value read (set to 0 if the read fails) or Value written
+ * @return True if the access was permitted, otherwise return False
+ */
+bool GuestMemory::resolveFault(uint32_t address, uint32_t size, uint32_t& value) {
+    uint32_t pageNumber = address >> pageBits;
+    uint8_t pagePermissions = this->fastPermissions[pageNumber];
+    bool isWrite = memoryFault.isWrite;
+    bool isPermitted = (pagePermissions & pageCommitted) && (pagePermissions & (isWrite ? PAGE_WRITE : PAGE_READ));
+
+    uint32_t oldValue = memoryFault.savedWord;
+    if(size == 1) {
+        oldValue = (oldValue >> (8 * (3 - (address & 3)))) & 0xFF;
+    }
+
+    if(isWrite && !isPermitted) {
+        storeBigEndian(this->fastBase + (address & ~3u), memoryFault.savedWord);
+    }
+
+    this->protectFastPage(pageNumber);
+    memoryFault.pending = 0;
+
+    if(!isPermitted) {
+        if(!isWrite) value = 0;
+        return false;
+    }
+
+    this->reportWatch(address, size, isWrite, isWrite ? oldValue : value, value);
+    return true;
+}
+
+/**
+ * SIGSEGV handler of the Fast Memory - commits a Page on its first write and marks clean Pages dirty, otherwise lets the access complete and leaves a pending Fault for the accessor
+ *
+ * @param signalNumber Signal received (SIGSEGV)
+ * @param signalInfo Informations about the Fault (faulting Host Address)
+ * @param signalContext Context of the faulting Thread
+ */
+void GuestMemory::handleFault(int signalNumber, siginfo_t* signalInfo, void* signalContext) {
+    #if defined(__linux__) && defined(__x86_64__)
+        uint8_t* faultPointer = static_cast<uint8_t*>(signalInfo->si_addr);
+
+        for(int memoryIndex = 0; memoryIndex < maxFastMemories; memoryIndex++) {
+            GuestMemory* guestMemory = fastMemories[memoryIndex].load(std::memory_order_acquire);
+
+            if(guestMemory == nullptr || faultPointer < guestMemory->fastBase || faultPointer >= guestMemory->fastBase + fastMemorySize) {
+                continue;
+            }
+
+            uint32_t address = static_cast<uint32_t>(faultPointer - guestMemory->fastBase);
+            uint32_t pageNumber = address >> pageBits;
+            uint8_t* hostPage = guestMemory->fastBase + (static_cast<uint64_t>(pageNumber) << pageBits);
+            uint8_t& pagePermissions = guestMemory->fastPermissions[pageNumber];
+            bool isWrite = static_cast<ucontext_t*>(signalContext)->uc_mcontext.gregs[REG_ERR] & 0x2;
+
+            if(isWrite && !(pagePermissions & pageCommitted)) {
+                pagePermissions = (pagePermissions & pageWatchMask) | pageCommitted | PAGE_READ | PAGE_WRITE;
+                guestMemory->markDirty(pageNumber);
+
+                if(!(pagePermissions & pageWatchMask)) {
+                    mprotect(hostPage, pageSize, PROT_READ | PROT_WRITE);
+                    return;
+                }
+            } else if(isWrite && (pagePermissions & pageClean) && (pagePermissions & PAGE_WRITE)) {
+                /* First write to a clean Page since the Dirty Pages were collected */
+                pagePermissions &= ~pageClean;
+                guestMemory->markDirty(pageNumber);
+
+                if(!(pagePermissions & pageWatchMask)) {
+                    mprotect(hostPage, pageSize, PROT_READ | PROT_WRITE);
+                    return;
+                }
+            }
+
+            mprotect(hostPage, pageSize, isWrite ? (PROT_READ | PROT_WRITE) : PROT_READ);
+
+            memoryFault.address = address;
+            memoryFault.isWrite = isWrite;
+            memoryFault.savedWord = isWrite ? loadBigEndian(guestMemory->fastBase + (address & ~3u)) : 0;
+            memoryFault.pending = 1;
+
+            return;
+        }
+
+        /* Not a Guest Memory access: restore the previous handler and let the access fault again */
+        sigaction(signalNumber, &previousFaultAction, nullptr);
+    #endif
+}
@@ -0,0 +1,228 @@
+#include "../includes/mips_emulator.h"
+
+#if defined(__unix__)
+    #include <sys/time.h>
+#endif
+
+std::atomic<bool> GuestProfiler::samplePending(false);
+GuestProfiler* GuestProfiler::activeProfiler = nullptr;
+
+/**
+ * GuestProfiler Constructor - the Profiler counts nothing until it is started
+ *
+ * @param entryAddress Address of the first executed Instruction (Root of the Call Stacks)
+ */
+GuestProfiler::GuestProfiler(uint32_t entryAddress) {
+    this->entryAddress = entryAddress;
+    this->callStack.reserve(maxCallDepth);
+}
+
+/**
+ * GuestProfiler Destructor - stops the Timer if it is still running
+ */
+GuestProfiler::~GuestProfiler() {
+    this->stop();
+}
+
+/**
+ * Start the host Interval Timer (ITIMER_PROF: the interval counts the CPU time of the process)
+ *
+ * @param sampleInterval Microseconds of CPU time between two Samples
+ * @return True if the Timer was started, False if another Profiler owns it or the platform has none
+ */
+bool GuestProfiler::start(uint32_t sampleInterval) {
+    #if defined(__unix__)
+        if(activeProfiler != nullptr || sampleInterval == 0) {
+            return false;
+        }
+
+        struct sigaction timerAction;
+        std::memset(&timerAction, 0, sizeof(timerAction));
+        timerAction.sa_handler = GuestProfiler::handleTimer;
+        timerAction.sa_flags = SA_RESTART;          //The Guest reads from stdin, the Timer must not interrupt them
+        sigemptyset(&timerAction.sa_mask);
+
+        if(sigaction(SIGPROF, &timerAction, nullptr) != 0) {
+            std::cout << "Profiler Timer not available!" << std::endl;
+            return false;
+        }
+
+        struct itimerval timerValue;
+        timerValue.it_interval.tv_sec = sampleInterval / 1000000;
+        timerValue.it_interval.tv_usec = sampleInterval % 1000000;
+        timerValue.it_value = timerValue.it_interval;
+
+        activeProfiler = this;
+        samplePending.store(false, std::memory_order_relaxed);
+
+        if(setitimer(ITIMER_PROF, &timerValue, nullptr) != 0) {
+            std::cout << "Profiler Timer not available!" << std::endl;
+            activeProfiler = nullptr;
+            return false;
+        }
+
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/**
+ * Stop the host Interval Timer - the Samples taken so far are kept
+ */
+void GuestProfiler::stop() {
+    #if defined(__unix__)
+        if(activeProfiler != this) {
+            return;
+        }
+
+        struct itimerval timerValue;
+        std::memset(&timerValue, 0, sizeof(timerValue));
+        setitimer(ITIMER_PROF, &timerValue, nullptr);
+
+        signal(SIGPROF, SIG_IGN);
+
+        activeProfiler = nullptr;
+        samplePending.store(false, std::memory_order_relaxed);
+    #endif
+}
+
+/**
+ * Clear the Samples and the Shadow Call Stack
+ *
+ * @param entryAddress Address of the first executed Instruction (Root of the Call Stacks)
+ */
+void GuestProfiler::reset(uint32_t entryAddress) {
+    this->entryAddress = entryAddress;
+    this->callStack.clear();
+    this->droppedCalls = 0;
+    this->sampleCounts.clear();
+    this->sampleCount = 0;
+}
+
+/**
+ * Push a Call on the Shadow Call Stack (jal)
+ *
+ * @param functionAddress Address the jal jumped to
+ * @param returnAddress Address stored in $ra
+ */
+void GuestProfiler::enterCall(uint32_t functionAddress, uint32_t returnAddress) {
+    if(this->callStack.size() == maxCallDepth) {
+        this->droppedCalls++;
+        return;
+    }
+
+    this->callStack.push_back({ functionAddress, returnAddress });
+}
+
+/**
+ * Pop the Calls up to the one returning to the Address (jr $ra) - a jr $ra that matches no Call leaves the Shadow Call Stack as it is
+ *
+ * @param returnAddress Address the jr $ra jumped to
+ */
+void GuestProfiler::leaveCall(uint32_t returnAddress) {
+    if(this->droppedCalls) {
+        this->droppedCalls--;
+        return;
+    }
+
+    for(size_t frameIndex = this->callStack.size(); frameIndex > 0; frameIndex--) {
+        if(this->callStack[frameIndex - 1].returnAddress == returnAddress) {
+            this->callStack.resize(frameIndex - 1);
+            return;
+        }
+    }
+}
+
+/**
+ * Record the current Call Stack - called at the Block boundary that follows a Timer tick
+ *
+ * @param PC Program Counter of the next Instruction
+ */
+void GuestProfiler::takeSample(uint32_t PC) {
+    samplePending.store(false, std::memory_order_relaxed);
+
+    this->sampleKey.clear();
+
+    for(const CallFrame& callFrame : this->callStack) {
+        this->sampleKey.push_back(callFrame.functionAddress);
+    }
+
+    this->sampleKey.push_back(PC);
+
+    this->sampleCounts[this->sampleKey]++;
+    this->sampleCount++;
+}
+
+/**
+ * Get the Number of Samples taken
+ *
+ * @return Number of Samples
+ */
+uint64_t GuestProfiler::getSampleCount() const {
+    return this->sampleCount;
+}
+
+/**
+ * Print the Samples in collapsed-stack format ("root;caller;callee count" per line, as read by flamegraph.pl)
+ * The Functions are named after the Label at their Address, the sampled Program Counter after the nearest Label
+ *
+ * @param symbolTable Symbol Table of the Guest
+ * @param output Stream the Samples are printed to
+ */
+void GuestProfiler::printCollapsedStacks(const SymbolTable& symbolTable, std::ostream& output) const {
+    auto frameName = [&symbolTable](uint32_t address) {
+        uint32_t symbolAddress;
+        const char* symbolName = symbolTable.findNearest(address, symbolAddress);
+
+        std::ostringstream nameStream;
+
+        if(symbolName != nullptr && symbolAddress == address) {
+            nameStream << symbolName;
+        } else if(symbolName != nullptr) {
+            nameStream << symbolName << "+0x" << std::hex << std::uppercase << (address - symbolAddress);
+        } else {
+            nameStream << "0x" << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << address;
+        }
+
+        return nameStream.str();
+    };
+
+    /* Samples at different Addresses can share a Label: their lines are merged */
+    std::map<std::string, uint64_t> collapsedStacks;
+
+    for(const auto& sampleEntry : this->sampleCounts) {
+        const std::vector<uint32_t>& sampleFrames = sampleEntry.first;
+        uint32_t samplePC = sampleFrames.back();
+
+        std::string collapsedStack = frameName(this->entryAddress);
+        uint32_t functionAddress = this->entryAddress;
+
+        for(size_t frameIndex = 0; frameIndex + 1 < sampleFrames.size(); frameIndex++) {
+            functionAddress = sampleFrames[frameIndex];
+            collapsedStack += ";" + frameName(functionAddress);
+        }
+
+        /* The Label of the sampled Instruction is a leaf only when it is not the Function itself */
+        uint32_t symbolAddress;
+        const char* symbolName = symbolTable.findNearest(samplePC, symbolAddress);
+
+        if(symbolName != nullptr && symbolAddress > functionAddress) {
+            collapsedStack += ";";
+            collapsedStack += symbolName;
+        }
+
+        collapsedStacks[collapsedStack] += sampleEntry.second;
+    }
+
+    for(const auto& stackEntry : collapsedStacks) {
+        output << stackEntry.first << " " << stackEntry.second << std::endl;
+    }
+}
+
+/**
+ * SIGPROF Handler - only sets the flag, the Sample is taken by the run loop at the next Block boundary
+ */
+void GuestProfiler::handleTimer(int) {
+    samplePending.store(true, std::memory_order_relaxed);
+}
@@ -6,13 +6,7 @@
  * @param value Value passed as Parameter that can be the Instruction or the Binary Value (specified by the Input Type)
  * @param inputType Input Type that says what does Value contain (an Instruction or the Binary Value)
  */
-Instruction::Instruction(std::string value, InputType inputType) {
-    if(inputType == INSTRUCTION_VALUE) {
-        parseInstruction(value);
-    } else if(inputType == BINARY_VALUE) {
-        parseBinary(value);
-    }
-}
+Instruction::Instruction(const std::string& value, InputType inputType) : Instruction(value, inputType, nullptr) {}
 
 /**
  * Instruction Constructor - Initializes the Instruction Object by parsing the Value passed as parameter and save the pointer to the Execution Scope
@@ -21,7 +15,18 @@ Instruction::Instruction(std::string value, InputType inputType) {
  * @param inputType Input Type that says what does Value contain (an Instruction or the Binary Value)
  * @param executionScope Execution Scope pointer that holds the Execution informations of the MIPS Emulator
  */
-Instruction::Instruction(std::string value, InputType inputType, ExecutionScope* executionScope) {
+Instruction::Instruction(const std::string& value, InputType inputType, ExecutionScope* executionScope) : Instruction(value, inputType, executionScope, std::pmr::get_default_resource()) {}
+
+/**
+ * Instruction Constructor - Initializes the Instruction Object by parsing the Value passed as parameter, its Fields and Parameters are allocated from the Memory Resource
+ *
+ * @param value Value passed as Parameter that can be the Instruction or the Binary Value (specified by the Input Type)
+ * @param inputType Input Type that says what does Value contain (an Instruction or the Binary Value)
+ * @param executionScope Execution Scope pointer that holds the Execution informations of the MIPS Emulator
+ * @param memoryResource Memory Resource (usually an arena) that must outlive the Instruction
+ */
+Instruction::Instruction(const std::string& value, InputType inputType, ExecutionScope* executionScope, std::pmr::memory_resource* memoryResource)
+    : name(memoryResource), instructionAddress(memoryResource), parameters(memoryResource), memoryFields(memoryResource) {
     if(inputType == INSTRUCTION_VALUE) {
         parseInstruction(value);
     } else if(inputType == BINARY_VALUE) {
@@ -36,14 +41,12 @@ Instruction::Instruction(std::string value, InputType inputType, ExecutionScope*
  *
  * @param instruction Instruction to be parsed
  */
-void Instruction::parseInstruction(std::string instruction) {
+void Instruction::parseInstruction(const std::string& instruction) {
     std::string currentParameter = "";
     int parameterIndex = 0;
 
-    std::transform(instruction.begin(), instruction.end(), instruction.begin(), ::tolower);
-
     for(int index = 0; index < instruction.size(); index++) {
-        char currentChar = instruction[index];
+        char currentChar = ::tolower(instruction[index]);
         bool currentAdd = false;
 
         if(currentChar != ' ' && currentChar != ',' && currentChar != '(' && currentChar != ')') {
@@ -53,7 +56,7 @@ void Instruction::parseInstruction(std::string instruction) {
 
         if((!currentAdd || index == instruction.size() - 1) && currentParameter.size()) {
             if(parameterIndex > 0) {
-                this->parameters.push_back(currentParameter);
+                this->parameters.emplace_back(currentParameter);
             } else {
                 this->name = currentParameter;
             }
@@ -63,14 +66,14 @@ void Instruction::parseInstruction(std::string instruction) {
         }
     }
 
-    if(this->parameters.size()) {
+    if(this->parameters.size() || instructionFormats.find(std::string_view(this->name)) != instructionFormats.end()) {
         this->statementType = INSTRUCTION;
     } else {
         this->statementType = LABEL;
         this->name.pop_back();
     }
 
-    auto posInstruction = instructionFormats.find(this->name);
+    auto posInstruction = instructionFormats.find(std::string_view(this->name));
     if(posInstruction != instructionFormats.end()) {
         memoryStructure = &posInstruction->second;
     }
@@ -81,7 +84,7 @@ void Instruction::parseInstruction(std::string instruction) {
  *
  * @param binary Binary Value to be parsed
  */
-void Instruction::parseBinary(std::string binary) {
+void Instruction::parseBinary(const std::string& binary) {
     std::string nameInstruction = "";
     std::string opcode = binary.substr(0, 6);
     std::string funct = "";
@@ -89,7 +92,8 @@ void Instruction::parseBinary(std::string binary) {
     if(opcode != std::string(6, 'x')) {
         this->statementType = INSTRUCTION;
 
-        if(toDecimal(opcode) == 0) {
+        /* SPECIAL (000000) and SPECIAL2 (011100) Instructions are selected by the Funct */
+        if(opcode == "000000" || opcode == "011100") {
             funct = binary.substr(26, 6);
         }
 
@@ -130,7 +134,7 @@ void Instruction::parseBinary(std::string binary) {
  */
 std::string Instruction::calculateBinary() {
     if(memoryStructure != nullptr) {
-        std::vector<std::string> parametersOrder = memoryStructure->getParametersOrder();
+        const std::vector<std::string>& parametersOrder = memoryStructure->getParametersOrder();
 
         setField("opcode", memoryStructure->getOpcode());
 
@@ -171,7 +175,7 @@ std::string Instruction::calculateBinary() {
 std::string Instruction::calculateInstruction() {
     if(getStatementType() == INSTRUCTION) {
         if(memoryStructure != nullptr) {
-            std::vector<std::string> parametersOrder = memoryStructure->getParametersOrder();
+            const std::vector<std::string>& parametersOrder = memoryStructure->getParametersOrder();
 
             this->name = calculateParameter("opcode", getField("opcode"));
 
@@ -198,7 +202,7 @@ std::string Instruction::calculateInstruction() {
  * @param parameterValue Parameter's Value to be converted into its Binary Value
  * @return Field's Binary Value calculated in base of the Parameter's Name and the Parameter's Value
  */
-std::string Instruction::calculateField(std::string parameterName, std::string parameterValue) {
+std::string Instruction::calculateField(const std::string& parameterName, const std::string& parameterValue) {
     int fieldSize = 0;
     std::string binaryValue = "";
 
@@ -233,23 +237,21 @@ std::string Instruction::calculateField(std::string parameterName, std::string p
         std::string value = "";
 
         if(isNumber(parameterValue) || isHex(parameterValue)) {
-            if(isHex(parameterValue)) {
-                parameterValue = std::to_string(toDecimal(parameterValue, HEX_FORMAT));
-            }
+            int numberValue = isHex(parameterValue) ? toDecimal(parameterValue, HEX_FORMAT) : std::stoi(parameterValue);
 
             if(parameterName == "shamt") {
-                value = std::bitset<5>(std::stoi(parameterValue)).to_string();
+                value = std::bitset<5>(numberValue).to_string();
             } else if(parameterName == "imm") {
-                value = toTwoComplement(std::stoi(parameterValue), 16);
+                value = toTwoComplement(numberValue, 16);
             } else if(parameterName == "addr") {
-                value = std::bitset<26>(std::stoi(parameterValue)).to_string();
+                value = std::bitset<26>(numberValue).to_string();
             }
         } else {
             if(this->executionScope != nullptr && this->instructionAddress != "") {
                 std::string labelAddress = executionScope->getLabelAddress(parameterValue);
 
                 if(parameterName == "imm") {
-                    value = shiftRightBinary(subBinary(labelAddress, instructionAddress), "10");
+                    value = shiftRightBinary(subBinary(labelAddress, std::string(instructionAddress)), "10");
                 } else if(parameterName == "addr") {
                     value = shiftRightBinary(labelAddress, "10");
                 }
@@ -271,7 +273,7 @@ std::string Instruction::calculateField(std::string parameterName, std::string p
  * @param fieldValue Field's Value that is in Binary to be converted into the Parameter's Value
  * @return Parameter's Value calculated in base of the Field's Name and the Field's Value
  */
-std::string Instruction::calculateParameter(std::string fieldName, std::string fieldValue) {
+std::string Instruction::calculateParameter(const std::string& fieldName, const std::string& fieldValue) {
     if(fieldName == "opcode") {
         std::string funct = memoryStructure->getFunct();
 
@@ -291,13 +293,13 @@ std::string Instruction::calculateParameter(std::string fieldName, std::string f
         if(this->memoryStructure->getInstructionPurpose() != INSTRUCTION_ADDRESS) {
             return std::to_string(fromTwoComplement(fieldValue));
         } else if(this->executionScope != nullptr && this->instructionAddress != "") {
-            std::string labelAddress = addBinary(this->instructionAddress, BranchAddr(fieldValue));
+            std::string labelAddress = addBinary(std::string(this->instructionAddress), BranchAddr(fieldValue));
 
             return executionScope->getLabelName(labelAddress);
         }
     } else if(fieldName == "addr") {
         if(this->executionScope != nullptr && this->instructionAddress != "") {
-            std::string labelAddress = JumpAddr(this->instructionAddress, fieldValue);
+            std::string labelAddress = JumpAddr(std::string(this->instructionAddress), fieldValue);
 
             return executionScope->getLabelName(labelAddress);
         } else {
@@ -314,7 +316,7 @@ std::string Instruction::calculateParameter(std::string fieldName, std::string f
  * @return Name of the Instruction
  */
 std::string Instruction::getName() {
-    return this->name;
+    return std::string(this->name);
 }
 
 /**
@@ -325,7 +327,7 @@ std::string Instruction::getName() {
  */
 std::string Instruction::getParameter(const int index) {
     if(index < this->parameters.size()) {
-        return this->parameters[index];
+        return std::string(this->parameters[index]);
     }
 
     return "";
@@ -337,10 +339,10 @@ std::string Instruction::getParameter(const int index) {
  * @param field Field's Name used to retrieve the Field's Value
  * @return Field's Value using the Field's Name to retrieve it
  */
-std::string Instruction::getField(std::string field) {
-    auto pos = memoryFields.find(field);
+std::string Instruction::getField(const std::string& field) {
+    auto pos = memoryFields.find(std::string_view(field));
     if(pos != memoryFields.end()) {
-        return pos->second;
+        return std::string(pos->second);
     }
 
     return "";
@@ -355,13 +357,26 @@ enum StatementType Instruction::getStatementType() {
     return this->statementType;
 };
 
+/**
+ * Get the Purpose of the Instruction
+ *
+ * @return Purpose of the Instruction (Maths / Logic / Address / Move), Labels are reported as Move
+ */
+enum InstructionPurpose Instruction::getInstructionPurpose() {
+    if(memoryStructure != nullptr) {
+        return memoryStructure->getInstructionPurpose();
+    }
+
+    return INSTRUCTION_MOVE;
+}
+
 /**
  * Get the Instruction's Binary Value
  *
  * @return Binary Value of the Instruction
  */
 std::string Instruction::getBinary() {
-    if(this->statementType == INSTRUCTION) {
+    if(this->statementType == INSTRUCTION && memoryStructure != nullptr) {
         std::string opcode = this->getField("opcode");
 
         if(memoryStructure->getFormat() == R_FORMAT) {
@@ -396,9 +411,9 @@ std::string Instruction::getBinary() {
  * @return Instruction's Value (String that contains the opcode and the parameters)
  */
 std::string Instruction::getInstruction() {
-    if(this->statementType == INSTRUCTION) {
-        std::vector<std::string> parametersOrder = memoryStructure->getParametersOrder();
-        std::string instruction = getName() + " ";
+    if(this->statementType == INSTRUCTION && memoryStructure != nullptr) {
+        const std::vector<std::string>& parametersOrder = memoryStructure->getParametersOrder();
+        std::string instruction = getName() + (parametersOrder.size() ? " " : "");
 
         if(memoryStructure->getFormat() == I_FORMAT && (parametersOrder.size() == 3 && parametersOrder[1] == "imm")) {
             instruction += getParameter(0) + ", " + getParameter(1) + "(" + getParameter(2) + ")";
@@ -415,7 +430,7 @@ std::string Instruction::getInstruction() {
         if(this->name.size()) {
             return getName() + ":";
         } else if(this->executionScope != nullptr && this->instructionAddress != "") {
-            return executionScope->getLabelName(instructionAddress) + ":";
+            return executionScope->getLabelName(std::string(instructionAddress)) + ":";
         } else {
             return "LABEL (name not assigned): ";
         }
@@ -429,7 +444,7 @@ std::string Instruction::getInstruction() {
  *
  * @param instructionAddress Address of the Instruction to be setted
  */
-void Instruction::setAddress(std::string instructionAddress) {
+void Instruction::setAddress(const std::string& instructionAddress) {
     this->instructionAddress = formatBinary(instructionAddress, 32);
 }
 
@@ -439,12 +454,18 @@ void Instruction::setAddress(std::string instructionAddress) {
  * @param fieldName Field's Name used to select the correct Field
  * @param fieldValue Field's Value that is set to the selected Field
  */
-void Instruction::setField(std::string fieldName, std::string fieldValue) {
+void Instruction::setField(const std::string& fieldName, const std::string& fieldValue) {
     auto posSize = fieldSizes.find(fieldName);
     if(posSize != fieldSizes.end()) {
         int fieldSize = posSize->second;
 
-        this->memoryFields[fieldName] = formatBinary(fieldValue, fieldSize);
+        auto posField = this->memoryFields.find(std::string_view(fieldName));
+
+        if(posField != this->memoryFields.end()) {
+            posField->second = formatBinary(fieldValue, fieldSize);
+        } else {
+            this->memoryFields.emplace(fieldName, formatBinary(fieldValue, fieldSize));
+        }
     }
 }
 
@@ -454,11 +475,11 @@ void Instruction::setField(std::string fieldName, std::string fieldValue) {
  * @param index Parameter's Index used to select the correct Parameter in the parameters array
  * @param parameterValue Parameter's Value that is set to the selected Parameter
  */
-void Instruction::setParameter(const int index, std::string parameterValue) {
+void Instruction::setParameter(const int index, const std::string& parameterValue) {
     if(index < this->parameters.size()) {
         this->parameters[index] = parameterValue;
     } else {
-        this->parameters.push_back(parameterValue);
+        this->parameters.emplace_back(parameterValue);
     }
 }
 
@@ -467,9 +488,12 @@ void Instruction::setParameter(const int index, std::string parameterValue) {
  */
 void Instruction::executeInstruction() {
     if(this->executionScope != nullptr) {
-        if(this->statementType == INSTRUCTION) {
+        if(this->statementType == INSTRUCTION && memoryStructure == nullptr) {
+            std::cout << "ERROR: Instruction does not exist!" << std::endl;
+            this->executionScope->halt(HALT_INVALID_INSTRUCTION);
+        } else if(this->statementType == INSTRUCTION) {
             std::vector<std::string> funcParams;
-            std::vector<std::string> parametersOrder = memoryStructure->getParametersOrder();
+            const std::vector<std::string>& parametersOrder = memoryStructure->getParametersOrder();
 
             for(int paramIndex = 0; paramIndex < parametersOrder.size(); paramIndex++) {
                 funcParams.push_back(this->getField(parametersOrder[paramIndex]));
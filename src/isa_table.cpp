@@ -0,0 +1,98 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * Row of the Instruction Set with its encoding
+ */
+struct IsaEntry {
+    const char* opcode;
+    const char* funct;
+    InstructionInfo instructionInfo;
+};
+
+/**
+ * Rows of the Instruction Set
+ */
+static constexpr IsaEntry isaEntries[] = {
+    #define DECODING_ENTRY(mnemonic, format, purpose, opcode, funct, operands, kind, operation, bytes) \
+        { opcode, funct, { #mnemonic, purpose, operands, kind, applyPointer<operation, uint32_t (*)(uint32_t, uint32_t)>(), \
+                           applyPointer<operation, bool (*)(uint32_t, uint32_t)>(), std::is_void_v<operation> ? "" : #operation, bytes } },
+
+    MIPS_INSTRUCTION_SET(DECODING_ENTRY)
+
+    #undef DECODING_ENTRY
+};
+
+/**
+ * Decoding Tables indexed by the Opcode, and by the Funct for the R-Format (Opcode 000000) and SPECIAL2 (Opcode 011100) Instructions
+ */
+struct DecodingTables {
+    InstructionInfo opcodeTable[64];
+    InstructionInfo functTable[64];
+    InstructionInfo special2Table[64];
+};
+
+/**
+ * Parse a Field written as a Binary String
+ *
+ * @param binaryField Binary String ("" is 0)
+ * @return Value of the Field
+ */
+static constexpr uint32_t parseField(const char* binaryField) {
+    uint32_t fieldValue = 0;
+
+    for(; *binaryField; binaryField++) {
+        fieldValue = (fieldValue << 1) | (*binaryField == '1');
+    }
+
+    return fieldValue;
+}
+
+/**
+ * Build the Decoding Tables from the Rows of the Instruction Set
+ *
+ * @return Decoding Tables
+ */
+static constexpr DecodingTables buildTables() {
+    DecodingTables decodingTables = {};
+    InstructionInfo invalidInfo = { "", INSTRUCTION_MOVE, OPERANDS_INVALID, KIND_INVALID, nullptr, nullptr, "", 0 };
+
+    for(uint32_t entryIndex = 0; entryIndex < 64; entryIndex++) {
+        decodingTables.opcodeTable[entryIndex] = invalidInfo;
+        decodingTables.functTable[entryIndex] = invalidInfo;
+        decodingTables.special2Table[entryIndex] = invalidInfo;
+    }
+
+    for(const IsaEntry& isaEntry : isaEntries) {
+        uint32_t opcode = parseField(isaEntry.opcode);
+
+        if(opcode == 0x00) {
+            decodingTables.functTable[parseField(isaEntry.funct)] = isaEntry.instructionInfo;
+        } else if(opcode == 0x1C) {
+            decodingTables.special2Table[parseField(isaEntry.funct)] = isaEntry.instructionInfo;
+        } else {
+            decodingTables.opcodeTable[opcode] = isaEntry.instructionInfo;
+        }
+    }
+
+    return decodingTables;
+}
+
+static constexpr DecodingTables decodingTables = buildTables();
+
+/**
+ * Decode an encoded Instruction through the Rows of the Instruction Set
+ *
+ * @param insValue Value of the Instruction
+ * @return Row of the Instruction (KIND_INVALID / OPERANDS_INVALID if the Word is not a valid Instruction)
+ */
+const InstructionInfo& decodeInstruction(uint32_t insValue) {
+    uint32_t opcode = opcodeField(insValue);
+
+    if(opcode == 0x00) {
+        return decodingTables.functTable[functField(insValue)];
+    } else if(opcode == 0x1C) {
+        return decodingTables.special2Table[functField(insValue)];
+    }
+
+    return decodingTables.opcodeTable[opcode];
+}
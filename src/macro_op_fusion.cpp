@@ -0,0 +1,178 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * lui + ori -> R[rt1] = {imm1, 16b0}, R[rt2] = R[rs2] | ZeroExtImm2
+ *
+ * @param executionScope Execution Scope
+ * @param fusedOperation Fused Operation (firstImmediate is already shifted to the upper Half-Word)
+ */
+static void LoadConstant_fused(ExecutionScope* executionScope, const FusedOperation& fusedOperation) {
+    executionScope->setRegisterWord(fusedOperation.firstDest, fusedOperation.firstImmediate);
+    executionScope->setRegisterWord(fusedOperation.secondDest, executionScope->getRegisterWord(fusedOperation.secondLeft) | fusedOperation.secondImmediate);
+    executionScope->setPC(fusedOperation.nextAddress);
+}
+
+/**
+ * sll + addu -> R[rd1] = R[rt1] << shamt1, R[rd2] = R[rs2] + R[rt2]
+ *
+ * @param executionScope Execution Scope
+ * @param fusedOperation Fused Operation
+ */
+static void ScaledIndex_fused(ExecutionScope* executionScope, const FusedOperation& fusedOperation) {
+    uint32_t shiftedValue = ShiftLeftOperation::apply(executionScope->getRegisterWord(fusedOperation.firstLeft), fusedOperation.firstImmediate);
+    executionScope->setRegisterWord(fusedOperation.firstDest, shiftedValue);
+
+    uint32_t sumValue = AddOperation::apply(executionScope->getRegisterWord(fusedOperation.secondLeft), executionScope->getRegisterWord(fusedOperation.secondRight));
+    executionScope->setRegisterWord(fusedOperation.secondDest, sumValue);
+
+    executionScope->setPC(fusedOperation.nextAddress);
+}
+
+/**
+ * slt / sltu + beq / bne -> R[rd1] = Comparison(R[rs1], R[rt1]), if(Condition(R[rs2], R[rt2])) { PC = BranchTarget }
+ *
+ * @param executionScope Execution Scope
+ * @param fusedOperation Fused Operation
+ */
+template<typename Comparison, typename Condition>
+static void CompareBranch_fused(ExecutionScope* executionScope, const FusedOperation& fusedOperation) {
+    uint32_t compareValue = Comparison::apply(executionScope->getRegisterWord(fusedOperation.firstLeft), executionScope->getRegisterWord(fusedOperation.firstRight));
+    executionScope->setRegisterWord(fusedOperation.firstDest, compareValue);
+
+    bool isTaken = Condition::apply(executionScope->getRegisterWord(fusedOperation.secondLeft), executionScope->getRegisterWord(fusedOperation.secondRight));
+    executionScope->setPC(isTaken ? fusedOperation.branchTarget : fusedOperation.nextAddress);
+}
+
+/**
+ * addi / addiu + beq / bne -> R[rt1] = R[rs1] + SignExtImm1, if(Condition(R[rs2], R[rt2])) { PC = BranchTarget }
+ *
+ * @param executionScope Execution Scope
+ * @param fusedOperation Fused Operation (firstImmediate is already sign-extended)
+ */
+template<typename Condition>
+static void CountedLoop_fused(ExecutionScope* executionScope, const FusedOperation& fusedOperation) {
+    uint32_t counterValue = AddOperation::apply(executionScope->getRegisterWord(fusedOperation.firstLeft), fusedOperation.firstImmediate);
+    executionScope->setRegisterWord(fusedOperation.firstDest, counterValue);
+
+    bool isTaken = Condition::apply(executionScope->getRegisterWord(fusedOperation.secondLeft), executionScope->getRegisterWord(fusedOperation.secondRight));
+    executionScope->setPC(isTaken ? fusedOperation.branchTarget : fusedOperation.nextAddress);
+}
+
+/**
+ * Find the Fused Operations of the Text Segment - only adjacent Instructions of the same Basic Block are paired
+ *
+ * @param controlFlowGraph Control-Flow Graph of the Text Segment
+ * @param textStart Address of the first Instruction
+ */
+void MacroOpFusion::analyze(const ControlFlowGraph& controlFlowGraph, uint32_t textStart) {
+    const std::vector<BasicBlock>& basicBlocks = controlFlowGraph.getBlocks();
+
+    this->clear();
+    this->textStart = textStart;
+
+    if(basicBlocks.empty()) {
+        return;
+    }
+
+    this->fusedOperations.assign((basicBlocks.back().endAddress - textStart) >> 2, FusedOperation());
+
+    for(const BasicBlock& basicBlock : basicBlocks) {
+        for(uint32_t insAddress = basicBlock.startAddress; insAddress + 4 < basicBlock.endAddress; insAddress += 4) {
+            FusedOperation& fusedOperation = this->fusedOperations[(insAddress - textStart) >> 2];
+
+            if(this->matchPair(controlFlowGraph.getWord(insAddress), controlFlowGraph.getWord(insAddress + 4), insAddress, fusedOperation)) {
+                this->patternCounts[fusedOperation.fusionPattern]++;
+
+                /* The second Instruction cannot start another pair */
+                insAddress += 4;
+            }
+        }
+    }
+}
+
+/**
+ * Remove every Fused Operation
+ */
+void MacroOpFusion::clear() {
+    this->fusedOperations.clear();
+    std::fill(std::begin(this->patternCounts), std::end(this->patternCounts), 0);
+}
+
+/**
+ * Get the number of pairs of the Text Segment matching an Idiom
+ *
+ * @param fusionPattern Idiom
+ * @return Number of Fused Operations of the Idiom
+ */
+uint64_t MacroOpFusion::getPatternCount(enum FusionPattern fusionPattern) const {
+    return this->patternCounts[fusionPattern];
+}
+
+/**
+ * Match a pair of Instructions against the fused Idioms - the second Instruction must use the Register written by the first one
+ *
+ * @param firstWord, secondWord Values of the two Instructions
+ * @param firstAddress Address of the first Instruction
+ * @param fusedOperation Fused Operation filled when the pair matches
+ * @return True if the pair matches an Idiom
+ */
+bool MacroOpFusion::matchPair(uint32_t firstWord, uint32_t secondWord, uint32_t firstAddress, FusedOperation& fusedOperation) const {
+    const InstructionInfo& firstInfo = decodeInstruction(firstWord);
+    const InstructionInfo& secondInfo = decodeInstruction(secondWord);
+    bool isSecondEqual = (secondInfo.condition == &EqualCondition::apply);
+    bool isSecondBranch = (isSecondEqual || secondInfo.condition == &NotEqualCondition::apply);
+
+    fusedOperation = FusedOperation();
+    fusedOperation.firstWord = firstWord;
+    fusedOperation.secondWord = secondWord;
+    fusedOperation.secondDest = rdField(secondWord);
+    fusedOperation.secondLeft = rsField(secondWord);
+    fusedOperation.secondRight = rtField(secondWord);
+    fusedOperation.nextAddress = firstAddress + 8;
+    fusedOperation.branchTarget = firstAddress + 8 + (static_cast<uint32_t>(static_cast<int16_t>(immediateField(secondWord))) << 2);
+    fusedOperation.endsBlock = isSecondBranch;
+
+    if(firstInfo.instructionKind == KIND_LOAD_UPPER && secondInfo.instructionKind == KIND_IMMEDIATE_UNSIGNED && secondInfo.operation == &OrOperation::apply &&
+       rsField(secondWord) == rtField(firstWord)) {
+        /* lui $t, hi + ori $d, $t, lo */
+        fusedOperation.fusionPattern = FUSION_LOAD_CONSTANT;
+        fusedOperation.fusedHandler = LoadConstant_fused;
+        fusedOperation.firstDest = rtField(firstWord);
+        fusedOperation.firstImmediate = immediateField(firstWord) << 16;
+        fusedOperation.secondDest = rtField(secondWord);
+        fusedOperation.secondImmediate = immediateField(secondWord);
+    } else if(firstInfo.instructionKind == KIND_SHIFT && firstInfo.operation == &ShiftLeftOperation::apply && firstWord != 0 &&
+              secondInfo.instructionKind == KIND_REGISTER && secondInfo.operation == &AddOperation::apply &&
+              (rsField(secondWord) == rdField(firstWord) || rtField(secondWord) == rdField(firstWord))) {
+        /* sll $i, $i, scale + addu $d, $base, $i (the Words 0 are the Labels) */
+        fusedOperation.fusionPattern = FUSION_SCALED_INDEX;
+        fusedOperation.fusedHandler = ScaledIndex_fused;
+        fusedOperation.firstDest = rdField(firstWord);
+        fusedOperation.firstLeft = rtField(firstWord);
+        fusedOperation.firstImmediate = shamtField(firstWord);
+    } else if(firstInfo.instructionKind == KIND_REGISTER && (firstInfo.operation == &LessThanOperation::apply || firstInfo.operation == &LessThanUnsignedOperation::apply) &&
+              isSecondBranch && (rsField(secondWord) == rdField(firstWord) || rtField(secondWord) == rdField(firstWord))) {
+        /* slt $t, $a, $b + bne $t, $zero, target */
+        bool isUnsigned = (firstInfo.operation == &LessThanUnsignedOperation::apply);
+
+        fusedOperation.fusionPattern = FUSION_COMPARE_BRANCH;
+        fusedOperation.fusedHandler = isUnsigned ? (isSecondEqual ? CompareBranch_fused<LessThanUnsignedOperation, EqualCondition> : CompareBranch_fused<LessThanUnsignedOperation, NotEqualCondition>)
+                                                 : (isSecondEqual ? CompareBranch_fused<LessThanOperation, EqualCondition> : CompareBranch_fused<LessThanOperation, NotEqualCondition>);
+        fusedOperation.firstDest = rdField(firstWord);
+        fusedOperation.firstLeft = rsField(firstWord);
+        fusedOperation.firstRight = rtField(firstWord);
+    } else if(firstInfo.instructionKind == KIND_IMMEDIATE && firstInfo.operation == &AddOperation::apply && rsField(firstWord) == rtField(firstWord) && isSecondBranch &&
+              (rsField(secondWord) == rtField(firstWord) || rtField(secondWord) == rtField(firstWord))) {
+        /* addi $t, $t, step + bne $t, $end, loop */
+        fusedOperation.fusionPattern = FUSION_COUNTED_LOOP;
+        fusedOperation.fusedHandler = isSecondEqual ? CountedLoop_fused<EqualCondition> : CountedLoop_fused<NotEqualCondition>;
+        fusedOperation.firstDest = rtField(firstWord);
+        fusedOperation.firstLeft = rsField(firstWord);
+        fusedOperation.firstImmediate = extendImmediate<SIGN_EXTENSION>(immediateField(firstWord));
+    } else {
+        fusedOperation = FusedOperation();
+        return false;
+    }
+
+    return true;
+}
@@ -2,9 +2,148 @@
 
 #include "../includes/mips_emulator.h"
 
-int main() {
-    ExecutionInterface* interface = new ExecutionInterface();
+int main(int argc, char* argv[]) {
+    enum MemoryBackend memoryBackend = PAGED_MEMORY;
+    uint64_t instructionBudget = 0;
+    bool lockstepEnabled = false;
+    enum StepGranularity lockstepGranularity = STEP_INSTRUCTION;
+    enum LockstepEngine lockstepEngine = LOCKSTEP_MEMORY;
+    ReplayLog* replayLog = nullptr;
+    std::string logPath = "";
+    enum LogMode logMode = LOG_RECORD;
+    bool printStatistics = false;
+    std::string profilePath = "";
+    uint32_t sampleInterval = defaultSampleInterval;
+    std::string graphPath = "";
+    bool fusionEnabled = true;
+    bool translationEnabled = true;
+    uint32_t coreCount = 1;
+    uint64_t quantum = 0;
+    uint32_t workerCount = 0;
+    uint32_t guestCount = 1;
+    uint32_t loopCount = 1;
+    uint64_t sliceLength = defaultSliceLength;
+
+    for(int argIndex = 1; argIndex < argc; argIndex++) {
+        std::string argument = argv[argIndex];
+
+        if(argument == "--fastmem") {
+            memoryBackend = FAST_MEMORY;
+        } else if(argument == "--no-fusion") {
+            fusionEnabled = false;
+        } else if(argument == "--no-translation") {
+            translationEnabled = false;
+        } else if(argument == "--stats") {
+            printStatistics = true;
+        } else if(argument == "--cores" && argIndex + 1 < argc) {
+            coreCount = static_cast<uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+        } else if(argument == "--deterministic") {
+            quantum = (quantum > 0) ? quantum : defaultQuantum;
+        } else if(argument == "--quantum" && argIndex + 1 < argc) {
+            quantum = std::strtoull(argv[++argIndex], nullptr, 10);
+        } else if(argument == "--workers" && argIndex + 1 < argc) {
+            workerCount = static_cast<uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+        } else if(argument == "--guests" && argIndex + 1 < argc) {
+            guestCount = static_cast<uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+        } else if(argument == "--loops" && argIndex + 1 < argc) {
+            loopCount = static_cast<uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+        } else if(argument == "--slice" && argIndex + 1 < argc) {
+            sliceLength = std::strtoull(argv[++argIndex], nullptr, 10);
+        } else if(argument == "--max-instructions" && argIndex + 1 < argc) {
+            instructionBudget = std::strtoull(argv[++argIndex], nullptr, 10);
+        } else if(argument == "--lockstep" && argIndex + 1 < argc) {
+            lockstepEnabled = true;
+            lockstepGranularity = (std::string(argv[++argIndex]) == "block") ? STEP_BLOCK : STEP_INSTRUCTION;
+        } else if(argument == "--lockstep-engine" && argIndex + 1 < argc) {
+            lockstepEngine = (std::string(argv[++argIndex]) == "interp") ? LOCKSTEP_INTERPRETER : LOCKSTEP_MEMORY;
+        } else if(argument == "--profile" && argIndex + 1 < argc) {
+            profilePath = argv[++argIndex];
+        } else if(argument == "--profile-interval" && argIndex + 1 < argc) {
+            sampleInterval = static_cast<uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+        } else if(argument == "--cfg" && argIndex + 1 < argc) {
+            graphPath = argv[++argIndex];
+        } else if((argument == "--record" || argument == "--replay") && argIndex + 1 < argc) {
+            logPath = argv[++argIndex];
+            logMode = (argument == "--record") ? LOG_RECORD : LOG_REPLAY;
+        }
+    }
+
+    /* The Cores of a Guest Machine share a Paged Memory and run on their own threads: the options built around a single Execution Scope do not apply */
+    if(coreCount > 1) {
+        std::string unsupportedOption = "";
+
+        if(guestCount > 1) {
+            unsupportedOption = "--guests";
+        } else if(memoryBackend == FAST_MEMORY) {
+            unsupportedOption = "--fastmem";
+        } else if(logPath != "") {
+            unsupportedOption = "--record / --replay";
+        } else if(printStatistics) {
+            unsupportedOption = "--stats";
+        } else if(profilePath != "") {
+            unsupportedOption = "--profile";
+        } else if(lockstepEnabled) {
+            unsupportedOption = "--lockstep";
+        } else if(graphPath != "") {
+            unsupportedOption = "--cfg";
+        }
+
+        if(unsupportedOption != "") {
+            std::cout << unsupportedOption << " cannot be used with --cores!" << std::endl;
+            return 1;
+        }
+    }
+
+    /* The Guests of the Event Loops have no Console and run interleaved: the options built around a single Execution Scope do not apply */
+    if(guestCount > 1) {
+        std::string unsupportedOption = "";
+
+        if(logPath != "") {
+            unsupportedOption = "--record / --replay";
+        } else if(printStatistics) {
+            unsupportedOption = "--stats";
+        } else if(profilePath != "") {
+            unsupportedOption = "--profile";
+        } else if(lockstepEnabled) {
+            unsupportedOption = "--lockstep";
+        } else if(graphPath != "") {
+            unsupportedOption = "--cfg";
+        }
+
+        if(unsupportedOption != "") {
+            std::cout << unsupportedOption << " cannot be used with --guests!" << std::endl;
+            return 1;
+        }
+    }
+
+    if(logPath != "") {
+        replayLog = new ReplayLog(logPath, logMode);
+
+        if(!replayLog->isOpen()) {
+            delete replayLog;
+            return 1;
+        }
+    }
+
+    ExecutionInterface* interface = new ExecutionInterface(memoryBackend);
+    interface->setInstructionBudget(instructionBudget);
+
+    if(lockstepEnabled) {
+        interface->setLockstep(lockstepGranularity, lockstepEngine);
+    }
+
+    interface->setReplayLog(replayLog);
+    interface->setPrintStatistics(printStatistics);
+    interface->setProfile(profilePath, sampleInterval);
+    interface->setGraphOutput(graphPath);
+    interface->setFusion(fusionEnabled);
+    interface->setTranslation(translationEnabled);
+    interface->setCores(coreCount);
+    interface->setQuantum(quantum, workerCount);
+    interface->setGuests(guestCount, loopCount, sliceLength);
     interface->executeInterface();
 
+    delete replayLog;
+
     return 0;
 }
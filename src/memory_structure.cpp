@@ -10,7 +10,7 @@
  * @param parametersOrder Order in which the Parameters are placed into the Instruction
  * @param instructionFunction Pointer to the Instruction's Function to be executed
  */
-MemoryStructure::MemoryStructure(Format format, InstructionPurpose instructionPurpose, std::string opcode, std::string funct, std::vector<std::string> parametersOrder, std::function<void(ExecutionScope*, std::vector<std::string>)> instructionFunction) {
+MemoryStructure::MemoryStructure(Format format, InstructionPurpose instructionPurpose, const std::string& opcode, const std::string& funct, const std::vector<std::string>& parametersOrder, std::function<void(ExecutionScope*, const std::vector<std::string>&)> instructionFunction) {
     this->format = format;
     this->opcode = opcode;
     this->funct = funct;
@@ -42,7 +42,7 @@ enum InstructionPurpose MemoryStructure::getInstructionPurpose() const {
  *
  * @return Opcode of the Instruction
  */
-std::string MemoryStructure::getOpcode() const {
+const std::string& MemoryStructure::getOpcode() const {
     return this->opcode;
 }
 
@@ -51,7 +51,7 @@ std::string MemoryStructure::getOpcode() const {
  *
  * @return Funct Code of the Instruction
  */
-std::string MemoryStructure::getFunct() const {
+const std::string& MemoryStructure::getFunct() const {
     return this->funct;
 }
 
@@ -60,7 +60,7 @@ std::string MemoryStructure::getFunct() const {
  *
  * @return Parameters Order of the Instruction (Order in which the Parameters are placed into the Instruction)
  */
-std::vector<std::string> MemoryStructure::getParametersOrder() const {
+const std::vector<std::string>& MemoryStructure::getParametersOrder() const {
     return this->parametersOrder;
 }
 
@@ -70,6 +70,6 @@ std::vector<std::string> MemoryStructure::getParametersOrder() const {
  * @param executionScope Execution Scope
  * @param funcParams Parameters Values
  */
-void MemoryStructure::executeFunction(ExecutionScope* executionScope, std::vector<std::string> funcParams) const {
+void MemoryStructure::executeFunction(ExecutionScope* executionScope, const std::vector<std::string>& funcParams) const {
     this->instructionFunction(executionScope, funcParams);
 }
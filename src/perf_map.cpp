@@ -0,0 +1,192 @@
+#include "../includes/mips_emulator.h"
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * Header of a jitdump File (see tools/perf/Documentation/jitdump-specification.txt in the Linux sources)
+ */
+struct JitDumpHeader {
+    uint32_t magic;         ///< 0x4A695444 ("JiTD" written in host order)
+    uint32_t version;       ///< Format Version (1)
+    uint32_t totalSize;     ///< Size in Bytes of the Header
+    uint32_t elfMachine;    ///< ELF Machine of the generated code
+    uint32_t padding;
+    uint32_t pid;           ///< Process that generated the code
+    uint64_t timestamp;     ///< Creation time (CLOCK_MONOTONIC, in nanoseconds)
+    uint64_t flags;
+};
+
+/**
+ * JIT_CODE_LOAD Record of a jitdump File - followed by the null-terminated Name and the Code Bytes
+ */
+struct JitCodeLoad {
+    uint32_t recordId;      ///< Record Type (0 = JIT_CODE_LOAD)
+    uint32_t totalSize;     ///< Size in Bytes of the Record, Name and Code included
+    uint64_t timestamp;     ///< Load time (CLOCK_MONOTONIC, in nanoseconds)
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;           ///< Virtual Address of the Code
+    uint64_t codeAddress;   ///< Address of the Code
+    uint64_t codeSize;      ///< Size in Bytes of the Code
+    uint64_t codeIndex;     ///< Unique Index of the Code
+};
+
+/**
+ * PerfMap Constructor - Creates the perf map of the Process, and the jitdump if requested
+ *
+ * @param writeJitDump True to also write jit-<pid>.dump in the working directory (needs "perf record -k mono" and "perf inject --jit")
+ */
+PerfMap::PerfMap(bool writeJitDump) {
+    #if defined(__linux__)
+        std::string mapPath = "/tmp/perf-" + std::to_string(getpid()) + ".map";
+        this->mapFile = std::fopen(mapPath.c_str(), "w");
+
+        if(this->mapFile == nullptr) {
+            std::cout << "perf map not writable!" << std::endl;
+        }
+
+        if(!writeJitDump) {
+            return;
+        }
+
+        std::string dumpPath = "jit-" + std::to_string(getpid()) + ".dump";
+        this->dumpFile = std::fopen(dumpPath.c_str(), "w+");
+
+        if(this->dumpFile == nullptr) {
+            std::cout << "jitdump not writable!" << std::endl;
+            return;
+        }
+
+        /* perf record notices the jitdump through an executable mapping of the File */
+        this->dumpMarker = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(this->dumpFile), 0);
+        if(this->dumpMarker == MAP_FAILED) {
+            this->dumpMarker = nullptr;
+        }
+
+        this->writeDumpHeader();
+    #endif
+}
+
+/**
+ * PerfMap Destructor - Closes the perf map and the jitdump (the Files are kept for perf report)
+ */
+PerfMap::~PerfMap() {
+    #if defined(__linux__)
+        if(this->mapFile != nullptr) {
+            std::fclose(this->mapFile);
+        }
+
+        if(this->dumpMarker != nullptr) {
+            munmap(this->dumpMarker, sysconf(_SC_PAGESIZE));
+        }
+
+        if(this->dumpFile != nullptr) {
+            std::fclose(this->dumpFile);
+        }
+    #endif
+}
+
+/**
+ * Publish a region of generated host code
+ *
+ * @param hostCode First Byte of the Code
+ * @param codeSize Size in Bytes of the Code
+ * @param name Name shown by perf for the Code
+ */
+void PerfMap::addCode(const void* hostCode, size_t codeSize, const std::string& name) {
+    #if defined(__linux__)
+        if(this->mapFile != nullptr) {
+            std::fprintf(this->mapFile, "%lx %lx %s\n", reinterpret_cast<unsigned long>(hostCode), static_cast<unsigned long>(codeSize), name.c_str());
+            std::fflush(this->mapFile);
+        }
+
+        if(this->dumpFile != nullptr) {
+            JitCodeLoad codeLoad;
+            codeLoad.recordId = 0;
+            codeLoad.totalSize = static_cast<uint32_t>(sizeof(codeLoad) + name.size() + 1 + codeSize);
+            codeLoad.timestamp = getTimestamp();
+            codeLoad.pid = static_cast<uint32_t>(getpid());
+            codeLoad.tid = static_cast<uint32_t>(syscall(SYS_gettid));
+            codeLoad.vma = reinterpret_cast<uint64_t>(hostCode);
+            codeLoad.codeAddress = reinterpret_cast<uint64_t>(hostCode);
+            codeLoad.codeSize = codeSize;
+            codeLoad.codeIndex = this->codeIndex++;
+
+            std::fwrite(&codeLoad, sizeof(codeLoad), 1, this->dumpFile);
+            std::fwrite(name.c_str(), name.size() + 1, 1, this->dumpFile);
+            std::fwrite(hostCode, codeSize, 1, this->dumpFile);
+            std::fflush(this->dumpFile);
+        }
+    #endif
+}
+
+/**
+ * Publish the host code of a translated Block, named after the nearest Guest Label and the Guest Address ("loop+0x8 [0x00400010]")
+ *
+ * @param hostCode First Byte of the Code
+ * @param codeSize Size in Bytes of the Code
+ * @param guestAddress Guest Address of the first Instruction of the Block
+ * @param symbolTable Symbol Table of the Guest
+ */
+void PerfMap::addBlock(const void* hostCode, size_t codeSize, uint32_t guestAddress, const SymbolTable& symbolTable) {
+    char name[maxDisassemblyLength + 32];
+    uint32_t symbolAddress;
+    const char* symbolName = symbolTable.findNearest(guestAddress, symbolAddress);
+
+    if(symbolName != nullptr) {
+        std::snprintf(name, sizeof(name), "%.*s+0x%X [0x%08X]", static_cast<int>(maxDisassemblyLength), symbolName, guestAddress - symbolAddress, guestAddress);
+    } else {
+        std::snprintf(name, sizeof(name), "guest [0x%08X]", guestAddress);
+    }
+
+    this->addCode(hostCode, codeSize, name);
+}
+
+/**
+ * Write the Header of the jitdump
+ */
+void PerfMap::writeDumpHeader() {
+    #if defined(__linux__)
+        JitDumpHeader dumpHeader;
+        dumpHeader.magic = 0x4A695444;
+        dumpHeader.version = 1;
+        dumpHeader.totalSize = sizeof(dumpHeader);
+
+        #if defined(__x86_64__)
+            dumpHeader.elfMachine = 62;     //EM_X86_64
+        #elif defined(__aarch64__)
+            dumpHeader.elfMachine = 183;    //EM_AARCH64
+        #else
+            dumpHeader.elfMachine = 0;
+        #endif
+
+        dumpHeader.padding = 0;
+        dumpHeader.pid = static_cast<uint32_t>(getpid());
+        dumpHeader.timestamp = getTimestamp();
+        dumpHeader.flags = 0;
+
+        std::fwrite(&dumpHeader, sizeof(dumpHeader), 1, this->dumpFile);
+        std::fflush(this->dumpFile);
+    #endif
+}
+
+/**
+ * Get the Timestamp used by the jitdump Records (perf must record with the same clock: perf record -k mono)
+ *
+ * @return CLOCK_MONOTONIC time in nanoseconds
+ */
+uint64_t PerfMap::getTimestamp() {
+    #if defined(__linux__)
+        struct timespec currentTime;
+        clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+        return static_cast<uint64_t>(currentTime.tv_sec) * 1000000000ull + currentTime.tv_nsec;
+    #else
+        return 0;
+    #endif
+}
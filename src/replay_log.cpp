@@ -0,0 +1,500 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * First Bytes of every Replay Log (the last Byte is the Format Version)
+ */
+const char ReplayLog::logMagic[8] = { 'M', 'I', 'P', 'S', 'L', 'O', 'G', 1 };
+
+/**
+ * ReplayLog Constructor - Opens the Log for appending (LOG_RECORD, an existing Log is replaced) or for reading (LOG_REPLAY)
+ *
+ * @param logPath Path of the Log File
+ * @param logMode Direction of the Log
+ */
+ReplayLog::ReplayLog(const std::string& logPath, enum LogMode logMode) {
+    this->logMode = logMode;
+    this->logBuffer.reserve(logBufferSize);
+
+    if(logMode == LOG_RECORD) {
+        this->logOutput.open(logPath, std::ios::binary | std::ios::trunc);
+
+        if(!this->logOutput.is_open()) {
+            std::cout << "Replay Log not writable!" << std::endl;
+            return;
+        }
+
+        this->writeData(logMagic, sizeof(logMagic));
+        return;
+    }
+
+    this->logInput.open(logPath, std::ios::binary);
+
+    char fileMagic[sizeof(logMagic)];
+
+    if(!this->logInput.is_open() || !this->readData(fileMagic, sizeof(fileMagic)) || std::memcmp(fileMagic, logMagic, sizeof(logMagic)) != 0) {
+        std::cout << "Replay Log not valid!" << std::endl;
+        this->logInput.close();
+        return;
+    }
+
+    this->fetchRecord();
+}
+
+/**
+ * ReplayLog Destructor - Writes the buffered Records
+ */
+ReplayLog::~ReplayLog() {
+    this->flush();
+}
+
+/**
+ * Retrieves whether the Log File is open
+ *
+ * @return True if the Log can be recorded / replayed, otherwise return False
+ */
+bool ReplayLog::isOpen() const {
+    return (this->logMode == LOG_RECORD) ? this->logOutput.is_open() : this->logInput.is_open();
+}
+
+/**
+ * Get the Direction of the Log
+ *
+ * @return Direction of the Log
+ */
+enum LogMode ReplayLog::getMode() const {
+    return this->logMode;
+}
+
+/**
+ * Write the buffered Records to the Log File (LOG_RECORD only)
+ */
+void ReplayLog::flush() {
+    if(this->logMode != LOG_RECORD || !this->logOutput.is_open()) return;
+
+    this->logOutput.write(this->logBuffer.data(), this->logBuffer.size());
+    this->logOutput.flush();
+
+    this->logBuffer.clear();
+}
+
+/**
+ * Record the source lines of the Program
+ *
+ * @param instructions Source lines of the Program
+ */
+void ReplayLog::recordProgram(const std::vector<std::string>& instructions) {
+    this->writeByte(LOG_PROGRAM);
+    this->writeNumber(instructions.size());
+
+    for(const std::string& instruction : instructions) {
+        this->writeNumber(instruction.size());
+        this->writeData(instruction.data(), instruction.size());
+    }
+}
+
+/**
+ * Record a line read by an input Syscall
+ *
+ * @param inputValue Line read (without the trailing newline)
+ */
+void ReplayLog::recordInput(const std::string& inputValue) {
+    this->writeByte(LOG_INPUT);
+    this->writeNumber(inputValue.size());
+    this->writeData(inputValue.data(), inputValue.size());
+}
+
+/**
+ * Record Words loaded by the host (stored in Little-Endian order)
+ *
+ * @param wordValues Values of the Words
+ * @param wordCount Number of Words
+ */
+void ReplayLog::recordWords(const uint32_t* wordValues, size_t wordCount) {
+    this->writeByte(LOG_LOAD_WORDS);
+    this->writeNumber(wordCount);
+
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        this->writeData(wordValues, 4 * wordCount);
+    #else
+        for(size_t wordIndex = 0; wordIndex < wordCount; wordIndex++) {
+            uint32_t wordValue = __builtin_bswap32(wordValues[wordIndex]);
+            this->writeData(&wordValue, 4);
+        }
+    #endif
+}
+
+/**
+ * Record Bytes loaded by the host
+ *
+ * @param byteValues Values of the Bytes
+ * @param byteCount Number of Bytes
+ */
+void ReplayLog::recordBytes(const uint8_t* byteValues, size_t byteCount) {
+    this->writeByte(LOG_LOAD_BYTES);
+    this->writeNumber(byteCount);
+    this->writeData(byteValues, byteCount);
+}
+
+/**
+ * Record a repeated Word loaded by the host
+ *
+ * @param wordValue Value of the Words
+ * @param wordCount Number of Words
+ */
+void ReplayLog::recordFill(uint32_t wordValue, size_t wordCount) {
+    this->writeByte(LOG_FILL);
+    this->writeNumber(wordValue);
+    this->writeNumber(wordCount);
+}
+
+/**
+ * Record the final Halt of the Execution, then write the buffered Records (the Log is complete up to this point)
+ *
+ * @param haltReason Reason why the Execution halted
+ * @param instructionCount Number of Instructions executed
+ * @param exitCode Exit Code of the Guest
+ */
+void ReplayLog::recordHalt(enum HaltReason haltReason, uint64_t instructionCount, int exitCode) {
+    this->writeByte(LOG_HALT);
+    this->writeNumber(haltReason);
+    this->writeNumber(instructionCount);
+    this->writeNumber(static_cast<uint32_t>(exitCode));
+
+    this->flush();
+}
+
+/**
+ * Get the Type of the next Record to replay
+ *
+ * @return Type of the next Record (LOG_END if the Log is exhausted)
+ */
+enum LogRecordType ReplayLog::peekRecord() const {
+    return this->nextRecord;
+}
+
+/**
+ * Replay the source lines of the Program
+ *
+ * @param instructions Vector the source lines are appended to
+ * @return True if the next Record holds the Program, otherwise return False
+ */
+bool ReplayLog::replayProgram(std::vector<std::string>& instructions) {
+    uint64_t lineCount;
+
+    if(!this->beginRecord(LOG_PROGRAM)) {
+        return false;
+    }
+
+    if(!this->readNumber(lineCount)) {
+        return this->truncateLog();
+    }
+
+    for(uint64_t lineIndex = 0; lineIndex < lineCount; lineIndex++) {
+        std::string instruction;
+
+        if(!this->readString(instruction)) {
+            return this->truncateLog();
+        }
+
+        instructions.push_back(instruction);
+    }
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Replay a line read by an input Syscall
+ *
+ * @param inputValue Line read (without the trailing newline)
+ * @return True if the next Record holds an Input, otherwise return False
+ */
+bool ReplayLog::replayInput(std::string& inputValue) {
+    if(!this->beginRecord(LOG_INPUT)) {
+        return false;
+    }
+
+    if(!this->readString(inputValue)) {
+        return this->truncateLog();
+    }
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Replay Words loaded by the host
+ *
+ * @param wordValues Values of the Words (replaced)
+ * @return True if the next Record holds Words, otherwise return False
+ */
+bool ReplayLog::replayWords(std::vector<uint32_t>& wordValues) {
+    uint64_t wordCount;
+
+    if(!this->beginRecord(LOG_LOAD_WORDS)) {
+        return false;
+    }
+
+    if(!this->readNumber(wordCount)) {
+        return this->truncateLog();
+    }
+
+    wordValues.resize(wordCount);
+
+    if(!this->readData(wordValues.data(), 4 * wordCount)) {
+        return this->truncateLog();
+    }
+
+    #if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+        for(uint32_t& wordValue : wordValues) {
+            wordValue = __builtin_bswap32(wordValue);
+        }
+    #endif
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Replay Bytes loaded by the host
+ *
+ * @param byteValues Values of the Bytes (replaced)
+ * @return True if the next Record holds Bytes, otherwise return False
+ */
+bool ReplayLog::replayBytes(std::vector<uint8_t>& byteValues) {
+    uint64_t byteCount;
+
+    if(!this->beginRecord(LOG_LOAD_BYTES)) {
+        return false;
+    }
+
+    if(!this->readNumber(byteCount)) {
+        return this->truncateLog();
+    }
+
+    byteValues.resize(byteCount);
+
+    if(!this->readData(byteValues.data(), byteCount)) {
+        return this->truncateLog();
+    }
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Replay a repeated Word loaded by the host
+ *
+ * @param wordValue Value of the Words
+ * @param wordCount Number of Words
+ * @return True if the next Record holds a Fill, otherwise return False
+ */
+bool ReplayLog::replayFill(uint32_t& wordValue, uint64_t& wordCount) {
+    uint64_t fillValue;
+
+    if(!this->beginRecord(LOG_FILL)) {
+        return false;
+    }
+
+    if(!this->readNumber(fillValue) || !this->readNumber(wordCount)) {
+        return this->truncateLog();
+    }
+
+    wordValue = static_cast<uint32_t>(fillValue);
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Replay the final Halt of the Execution
+ *
+ * @param haltReason Reason why the recorded Execution halted
+ * @param instructionCount Number of Instructions executed by the recorded Execution
+ * @param exitCode Exit Code of the recorded Guest
+ * @return True if the next Record holds a Halt, otherwise return False
+ */
+bool ReplayLog::replayHalt(enum HaltReason& haltReason, uint64_t& instructionCount, int& exitCode) {
+    uint64_t haltValue, exitValue;
+
+    if(!this->beginRecord(LOG_HALT)) {
+        return false;
+    }
+
+    if(!this->readNumber(haltValue) || !this->readNumber(instructionCount) || !this->readNumber(exitValue)) {
+        return this->truncateLog();
+    }
+
+    haltReason = static_cast<enum HaltReason>(haltValue);
+    exitCode = static_cast<int32_t>(exitValue);
+
+    this->fetchRecord();
+    return true;
+}
+
+/**
+ * Append a Byte to the Log
+ *
+ * @param byteValue Value of the Byte
+ */
+void ReplayLog::writeByte(uint8_t byteValue) {
+    if(this->logBuffer.size() == logBufferSize) {
+        this->flush();
+    }
+
+    this->logBuffer.push_back(static_cast<char>(byteValue));
+}
+
+/**
+ * Append a Number to the Log (LEB128: 7 bits per Byte, small Numbers take one Byte)
+ *
+ * @param numberValue Value of the Number
+ */
+void ReplayLog::writeNumber(uint64_t numberValue) {
+    while(numberValue >= 0x80) {
+        this->writeByte(static_cast<uint8_t>(numberValue | 0x80));
+        numberValue >>= 7;
+    }
+
+    this->writeByte(static_cast<uint8_t>(numberValue));
+}
+
+/**
+ * Append raw Data to the Log - Data larger than the Buffer is written straight to the Log File
+ *
+ * @param data First Byte of the Data
+ * @param size Size in Bytes of the Data
+ */
+void ReplayLog::writeData(const void* data, size_t size) {
+    if(this->logBuffer.size() + size > logBufferSize) {
+        this->flush();
+    }
+
+    if(size >= logBufferSize) {
+        if(this->logOutput.is_open()) {
+            this->logOutput.write(static_cast<const char*>(data), size);
+        }
+
+        return;
+    }
+
+    const char* dataBytes = static_cast<const char*>(data);
+    this->logBuffer.insert(this->logBuffer.end(), dataBytes, dataBytes + size);
+}
+
+/**
+ * Read the next Byte of the Log, refilling the Buffer from the Log File when it is empty
+ *
+ * @param byteValue Value of the Byte
+ * @return True if a Byte was read, False at the end of the Log
+ */
+bool ReplayLog::readByte(uint8_t& byteValue) {
+    if(this->bufferPosition == this->logBuffer.size()) {
+        this->logBuffer.resize(logBufferSize);
+        this->logInput.read(this->logBuffer.data(), logBufferSize);
+        this->logBuffer.resize(this->logInput.gcount());
+        this->bufferPosition = 0;
+
+        if(this->logBuffer.empty()) {
+            return false;
+        }
+    }
+
+    byteValue = static_cast<uint8_t>(this->logBuffer[this->bufferPosition++]);
+    return true;
+}
+
+/**
+ * Read the next Number of the Log (LEB128)
+ *
+ * @param numberValue Value of the Number
+ * @return True if a Number was read, False at the end of the Log
+ */
+bool ReplayLog::readNumber(uint64_t& numberValue) {
+    uint8_t byteValue;
+    numberValue = 0;
+
+    for(int shiftBits = 0; shiftBits < 64; shiftBits += 7) {
+        if(!this->readByte(byteValue)) {
+            return false;
+        }
+
+        numberValue |= static_cast<uint64_t>(byteValue & 0x7F) << shiftBits;
+
+        if(!(byteValue & 0x80)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Read raw Data from the Log - what is left in the Buffer is copied first, the rest is read straight from the Log File
+ *
+ * @param data Buffer the Data is copied to
+ * @param size Size in Bytes of the Data
+ * @return True if the whole Data was read, False at the end of the Log
+ */
+bool ReplayLog::readData(void* data, size_t size) {
+    size_t bufferedSize = std::min(size, this->logBuffer.size() - this->bufferPosition);
+    std::memcpy(data, this->logBuffer.data() + this->bufferPosition, bufferedSize);
+    this->bufferPosition += bufferedSize;
+
+    if(bufferedSize == size) {
+        return true;
+    }
+
+    this->logInput.read(static_cast<char*>(data) + bufferedSize, size - bufferedSize);
+
+    return static_cast<size_t>(this->logInput.gcount()) == size - bufferedSize;
+}
+
+/**
+ * Read a length-prefixed String from the Log
+ *
+ * @param stringValue Value of the String
+ * @return True if the String was read, False at the end of the Log
+ */
+bool ReplayLog::readString(std::string& stringValue) {
+    uint64_t stringLength;
+
+    if(!this->readNumber(stringLength)) {
+        return false;
+    }
+
+    stringValue.resize(stringLength);
+
+    return this->readData(&stringValue[0], stringLength);
+}
+
+/**
+ * Check the Type of the next Record before it is decoded
+ *
+ * @param recordType Type of Record expected
+ * @return True if the next Record has the expected Type, otherwise return False
+ */
+bool ReplayLog::beginRecord(enum LogRecordType recordType) {
+    return this->logMode == LOG_REPLAY && this->nextRecord == recordType;
+}
+
+/**
+ * Read the Type of the next Record (LOG_END at the end of the Log)
+ */
+void ReplayLog::fetchRecord() {
+    uint8_t recordType;
+
+    this->nextRecord = this->readByte(recordType) ? static_cast<enum LogRecordType>(recordType) : LOG_END;
+}
+
+/**
+ * Stop replaying a Log whose last Record is truncated
+ *
+ * @return False (the Record could not be replayed)
+ */
+bool ReplayLog::truncateLog() {
+    std::cout << "Replay Log truncated!" << std::endl;
+    this->nextRecord = LOG_END;
+
+    return false;
+}
@@ -0,0 +1,213 @@
+#include "../includes/mips_emulator.h"
+
+/**
+ * SymbolTable Constructor - Initializes an empty Hash Map
+ */
+SymbolTable::SymbolTable() {
+    this->hashSlots.assign(64, { nullptr, 0, 0, 0 });
+}
+
+/**
+ * Define a Symbol, or move it if it is already defined
+ *
+ * @param name Name of the Symbol
+ * @param address Address of the Symbol
+ */
+void SymbolTable::addSymbol(const std::string& name, uint32_t address) {
+    uint32_t hash = hashName(name.data(), name.size());
+    HashSlot* slot = &this->hashSlots[this->findSlot(name.data(), name.size(), hash)];
+
+    if(slot->name != nullptr) {
+        slot->address = address;
+
+        for(Symbol& symbol : this->sortedSymbols) {
+            if(symbol.name == slot->name) symbol.address = address;
+        }
+
+        this->symbolsSorted = false;
+        return;
+    }
+
+    slot->name = this->internName(name.data(), name.size());
+    slot->length = name.size();
+    slot->hash = hash;
+    slot->address = address;
+
+    /* Labels are usually defined in Address order: appending keeps the vector sorted */
+    if(!this->sortedSymbols.empty() && this->sortedSymbols.back().address > address) {
+        this->symbolsSorted = false;
+    }
+
+    this->sortedSymbols.push_back({ address, slot->name });
+
+    /* The Hash Map is kept at most half full */
+    if(++this->symbolCount * 2 > this->hashSlots.size()) {
+        this->growHashMap();
+    }
+}
+
+/**
+ * Find the Address of a Symbol
+ *
+ * @param name Name of the Symbol
+ * @param address Address of the Symbol (unchanged if the Symbol is not defined)
+ * @return True if the Symbol is defined, otherwise return False
+ */
+bool SymbolTable::findAddress(const std::string& name, uint32_t& address) const {
+    const HashSlot* slot = &this->hashSlots[this->findSlot(name.data(), name.size(), hashName(name.data(), name.size()))];
+
+    if(slot->name == nullptr) {
+        return false;
+    }
+
+    address = slot->address;
+    return true;
+}
+
+/**
+ * Find the Symbol defined at an Address (the last defined one if several Symbols share the Address)
+ *
+ * @param address Address of the Symbol
+ * @return Name of the Symbol, nullptr if no Symbol is defined at the Address
+ */
+const char* SymbolTable::findName(uint32_t address) const {
+    uint32_t symbolAddress;
+    const char* name = this->findNearest(address, symbolAddress);
+
+    return (name != nullptr && symbolAddress == address) ? name : nullptr;
+}
+
+/**
+ * Find the nearest Symbol defined at or before an Address
+ *
+ * @param address Address to look up
+ * @param symbolAddress Address of the Symbol found
+ * @return Name of the Symbol, nullptr if no Symbol is defined at or before the Address
+ */
+const char* SymbolTable::findNearest(uint32_t address, uint32_t& symbolAddress) const {
+    this->sortSymbols();
+
+    auto posSymbol = std::upper_bound(this->sortedSymbols.begin(), this->sortedSymbols.end(), address,
+                                      [](uint32_t value, const Symbol& symbol) { return value < symbol.address; });
+
+    if(posSymbol == this->sortedSymbols.begin()) {
+        return nullptr;
+    }
+
+    --posSymbol;
+    symbolAddress = posSymbol->address;
+
+    return posSymbol->name;
+}
+
+/**
+ * Get the Symbols sorted by Address
+ *
+ * @return Symbols sorted by Address
+ */
+const std::vector<Symbol>& SymbolTable::getSymbols() const {
+    this->sortSymbols();
+
+    return this->sortedSymbols;
+}
+
+/**
+ * Get the number of defined Symbols
+ *
+ * @return Number of defined Symbols
+ */
+size_t SymbolTable::size() const {
+    return this->symbolCount;
+}
+
+/**
+ * Hash a Name (FNV-1a)
+ *
+ * @param name First character of the Name
+ * @param length Length of the Name
+ * @return Hash of the Name
+ */
+uint32_t SymbolTable::hashName(const char* name, size_t length) {
+    uint32_t hash = 2166136261u;
+
+    for(size_t charIndex = 0; charIndex < length; charIndex++) {
+        hash = (hash ^ static_cast<uint8_t>(name[charIndex])) * 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * Find the Slot of a Name - the Slot that holds the Name, otherwise the empty Slot where it would be inserted
+ *
+ * @param name First character of the Name
+ * @param length Length of the Name
+ * @param hash Hash of the Name
+ * @return Index of the Slot of the Name
+ */
+size_t SymbolTable::findSlot(const char* name, size_t length, uint32_t hash) const {
+    size_t slotMask = this->hashSlots.size() - 1;
+
+    for(size_t slotIndex = hash & slotMask; ; slotIndex = (slotIndex + 1) & slotMask) {
+        const HashSlot& slot = this->hashSlots[slotIndex];
+
+        if(slot.name == nullptr || (slot.hash == hash && slot.length == length && std::memcmp(slot.name, name, length) == 0)) {
+            return slotIndex;
+        }
+    }
+}
+
+/**
+ * Copy a Name into the arena
+ *
+ * @param name First character of the Name
+ * @param length Length of the Name
+ * @return Interned null-terminated copy of the Name, valid as long as the Symbol Table
+ */
+const char* SymbolTable::internName(const char* name, size_t length) {
+    if(this->arenaUsed + length + 1 > arenaChunkSize) {
+        this->arenaChunks.emplace_back(new char[(length + 1 > arenaChunkSize) ? length + 1 : arenaChunkSize]);
+        this->arenaUsed = 0;
+    }
+
+    char* internedName = this->arenaChunks.back().get() + this->arenaUsed;
+    std::memcpy(internedName, name, length);
+    internedName[length] = '\0';
+
+    this->arenaUsed += length + 1;
+
+    return internedName;
+}
+
+/**
+ * Double the capacity of the Hash Map and reinsert every Slot
+ */
+void SymbolTable::growHashMap() {
+    std::vector<HashSlot> oldSlots(this->hashSlots.size() * 2, { nullptr, 0, 0, 0 });
+    oldSlots.swap(this->hashSlots);
+
+    size_t slotMask = this->hashSlots.size() - 1;
+
+    for(const HashSlot& slot : oldSlots) {
+        if(slot.name == nullptr) continue;
+
+        size_t slotIndex = slot.hash & slotMask;
+        while(this->hashSlots[slotIndex].name != nullptr) {
+            slotIndex = (slotIndex + 1) & slotMask;
+        }
+
+        this->hashSlots[slotIndex] = slot;
+    }
+}
+
+/**
+ * Sort the Symbols by Address if a Symbol was defined or moved out of order
+ */
+void SymbolTable::sortSymbols() const {
+    if(this->symbolsSorted) return;
+
+    std::stable_sort(this->sortedSymbols.begin(), this->sortedSymbols.end(),
+                     [](const Symbol& symbolA, const Symbol& symbolB) { return symbolA.address < symbolB.address; });
+
+    this->symbolsSorted = true;
+}